@@ -2,16 +2,20 @@
 #define MANAGER_UTILS_DYNAMICIMAGE_H_
 
 // System headers
+#include <cstdint>
 
 // Other libraries headers
+#include "utils/ErrorCode.h"
 
 // Own components headers
 #include "manager_utils/drawing/Image.h"
+#include "manager_utils/drawing/OnDemandRsrcHandle.h"
 
 // Forward declarations
 
 class DynamicImage : public Image {
  public:
+  DynamicImage();
   ~DynamicImage();
 
   DynamicImage(DynamicImage&& movedOther);
@@ -28,7 +32,8 @@ class DynamicImage : public Image {
    *   NOTE: The underlying implementation uses reference counting.
    *         What this means is when you invoke ::create() several times
    *         on the same resourceId only 1 unique instance of the resource
-   *         will be loaded into memory.
+   *         will be loaded into memory. Only the first ::create() loads,
+   *         the following ones are O(1).
    *
    *   NOTE2: you if have the following case:
    *          DynamicImage::loadResourceOnDemandSingle(someRsrcId1);
@@ -61,6 +66,34 @@ class DynamicImage : public Image {
    * */
   void create(const uint64_t rsrcId);
 
+  /** @brief asynchronous counterpart of ::create().
+   *         The resource is streamed by the RsrcMgr (decode on the
+   *         SDLContainers worker threads, upload on the drawing thread),
+   *         so the calling thread never blocks on disk I/O and decode.
+   *         The DynamicImage is not drawn until the resource is ready.
+   *
+   *         NOTE: ::process() must be called every frame in order
+   *               to pick up the result.
+   *
+   *  @param const uint64_t - unique resource ID
+   *  @param const int32_t  - streaming priority (higher is loaded first)
+   *  @param const int64_t  - deadline in milliseconds from now
+   *                          (NO_STREAM_DEADLINE for none)
+   * */
+  void createAsync(const uint64_t rsrcId, const int32_t priority,
+                   const int64_t deadlineMs);
+
+  /** @brief used to pick up the result of a pending ::createAsync()
+   * */
+  void process();
+
+  bool isAsyncRequestPending() const { return 0 != _streamTicket; }
+
+  /** @brief apply (draw) the image to the currently active back buffer.
+   *         A DynamicImage with pending ::createAsync() is skipped.
+   * */
+  void draw() const;
+
   /** @brief used to destroy DynamicImage texture.  In order to use the
    *         DynamicImage texture again - it needs to be re-created.
    *                                      (Invoking of .create() method)
@@ -78,6 +111,21 @@ class DynamicImage : public Image {
    *          implementation. Proceed with caution!
    * */
   void destroy();
+
+ private:
+  /** @brief used to populate the Image from an already loaded resource
+   *
+   *  @return ErrorCode - error code
+   * */
+  ErrorCode applyRsrcData(const uint64_t rsrcId);
+
+  void cancelAsyncRequest();
+
+  // reference to the loaded on-demand resource
+  OnDemandRsrcHandle _rsrcHandle;
+
+  // ticket of the pending ::createAsync() request (0 if none)
+  uint64_t _streamTicket;
 };
 
 #endif /* MANAGER_UTILS_DYNAMICIMAGE_H_ */
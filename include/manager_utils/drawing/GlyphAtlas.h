@@ -0,0 +1,119 @@
+#ifndef MANAGER_UTILS_GLYPHATLAS_H_
+#define MANAGER_UTILS_GLYPHATLAS_H_
+
+/*
+ * GlyphAtlas.h
+ *
+ *  Brief: Holds the printable ASCII glyphs for a (fontId, color) pair,
+ *         rasterized once in a single shared Fbo texture.
+ *         Strings are drawn as batches of sub-rectangles of that texture
+ *         (check GlyphText), so changing their content costs no
+ *         rasterization and no texture upload.
+ *
+ *         NOTE: the font size is part of the fontId.
+ *         NOTE2: glyphs are rasterized one by one, so font kerning is
+ *                not applied.
+ *
+ *         Atlases are shared and should be acquired from the RsrcMgr
+ *         (::acquireGlyphAtlas() / ::releaseGlyphAtlas()).
+ */
+
+// System headers
+#include <cstdint>
+#include <vector>
+
+// Other libraries headers
+#include "utils/drawing/Color.h"
+#include "utils/class/NonCopyable.h"
+#include "utils/class/NonMoveable.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+#include "manager_utils/drawing/Fbo.h"
+#include "manager_utils/drawing/Text.h"
+
+// Forward declarations
+
+class GlyphAtlas : public NonCopyable, public NonMoveable {
+public:
+  static constexpr char FIRST_GLYPH = ' ';
+  static constexpr char LAST_GLYPH = '~';
+  static constexpr int32_t GLYPHS_COUNT = LAST_GLYPH - FIRST_GLYPH + 1;
+
+  GlyphAtlas();
+
+  ~GlyphAtlas() noexcept;
+
+  /** @brief used to rasterize the glyphs and upload them to the atlas
+   *
+   *  @param const uint64_t - unique font ID
+   *  @param const Color &  - glyphs color
+   *
+   *  @return ErrorCode     - error code
+   * */
+  ErrorCode create(const uint64_t fontId, const Color &color);
+
+  void destroy();
+
+  /** @brief used to release the temporary glyph textures, once the atlas
+   *         upload has been executed by the renderer
+   * */
+  void process();
+
+  bool hasGlyph(const char glyph) const;
+
+  /** @brief used to acquire the atlas rectangle for a glyph.
+   *         Unsupported glyphs are mapped to '?'
+   *
+   *  @param const char - the glyph
+   *
+   *  @return const Rectangle & - the glyph atlas rectangle
+   * */
+  const Rectangle &getGlyphRect(const char glyph) const;
+
+  int32_t getLineHeight() const {
+    return _lineHeight;
+  }
+
+  uint64_t getFontId() const {
+    return _fontId;
+  }
+
+  const Color &getColor() const {
+    return _color;
+  }
+
+  /** @brief used to acquire the draw params of the whole atlas texture.
+   *         Glyph draw params are produced by changing the frame rectangle
+   *         and the position.
+   * */
+  DrawParams getDrawParams() const {
+    return _atlasFbo.getDrawParams();
+  }
+
+  bool isCreated() const {
+    return _atlasFbo.isCreated();
+  }
+
+private:
+  static int32_t getGlyphIdx(const char glyph) {
+    return glyph - FIRST_GLYPH;
+  }
+
+  Fbo _atlasFbo;
+
+  /** The glyph texts are kept alive until the atlas upload is executed,
+   *  because in RendererPolicy::MULTI_THREADED it is done by the
+   *  render thread at a later point
+   * */
+  std::vector<Text> _glyphTexts;
+  uint64_t _uploadFrame;
+
+  Rectangle _glyphRects[GLYPHS_COUNT];
+
+  uint64_t _fontId;
+  Color _color;
+  int32_t _lineHeight;
+};
+
+#endif /* MANAGER_UTILS_GLYPHATLAS_H_ */
@@ -0,0 +1,132 @@
+#ifndef MANAGER_UTILS_GLYPHTEXT_H_
+#define MANAGER_UTILS_GLYPHTEXT_H_
+
+/*
+ * GlyphText.h
+ *
+ *  Brief: A text, drawn from a shared GlyphAtlas.
+ *         The text content is represented as a batch of glyph DrawParams,
+ *         so ::setText() costs no rasterization and no texture upload.
+ *         Suitable for frequently changing texts (scores, timers, etc.)
+ *
+ *         NOTE: only printable ASCII glyphs are supported. The rest are
+ *               drawn as '?'.
+ *         NOTE2: since the atlas texture is shared - per text opacity is
+ *                not supported.
+ */
+
+// System headers
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// Other libraries headers
+#include "sdl_utils/drawing/DrawParams.h"
+#include "utils/drawing/Color.h"
+#include "utils/class/NonCopyable.h"
+
+// Own components headers
+
+// Forward declarations
+class GlyphAtlas;
+
+class GlyphText : public NonCopyable {
+public:
+  GlyphText();
+  ~GlyphText() noexcept;
+
+  GlyphText(GlyphText &&movedOther);
+  GlyphText& operator=(GlyphText &&movedOther);
+
+  /** @brief used to create the text. The GlyphAtlas for the
+   *         (fontId, color) pair is built on first use.
+   *
+   *  @param const fontId   - unique font ID
+   *  @param const char *   - text content
+   *  @param const Color &  - color of the text
+   *  @param const Point    - the position of the text
+   * */
+  void create(const uint64_t fontId, const char *text, const Color &color,
+              const Point &pos = Points::ZERO);
+
+  void destroy();
+
+  /** @brief used to set new content of the text.
+   *         No rasterization is performed.
+   *
+   *  @param const char * - new text content to be displayed
+   * */
+  void setText(const char *text);
+
+  /** @brief used to change the text color. The GlyphAtlas is switched
+   *         to the one for the new color (which is built on first use).
+   *
+   *  @param const Color & - new color of the text
+   * */
+  void setColor(const Color &color);
+
+  void setPosition(const int32_t x, const int32_t y);
+
+  void setPosition(const Point &pos) {
+    setPosition(pos.x, pos.y);
+  }
+
+  Point getPosition() const {
+    return _pos;
+  }
+
+  int32_t getWidth() const {
+    return _width;
+  }
+
+  int32_t getHeight() const {
+    return _height;
+  }
+
+  const char *getText() const {
+    return _textContent.c_str();
+  }
+
+  void hide() {
+    _isVisible = false;
+  }
+
+  void show() {
+    _isVisible = true;
+  }
+
+  bool isVisible() const {
+    return _isVisible;
+  }
+
+  bool isCreated() const {
+    return _isCreated;
+  }
+
+  /** @brief used to add the glyph draw commands for the current frame
+   * */
+  void draw() const;
+
+private:
+  /** @brief used to regenerate the glyph DrawParams from the text content
+   * */
+  void layoutGlyphs();
+
+  void resetInternals();
+
+  std::vector<DrawParams> _glyphs;
+
+  std::string _textContent;
+
+  // shared atlas, owned by the RsrcMgr
+  GlyphAtlas *_atlas;
+
+  Point _pos;
+  int32_t _width;
+  int32_t _height;
+
+  bool _isCreated;
+  bool _isVisible;
+};
+
+#endif /* MANAGER_UTILS_GLYPHTEXT_H_ */
@@ -13,9 +13,9 @@
 
 // Own components headers
 #include "manager_utils/drawing/Widget.h"
+#include "manager_utils/drawing/Sprite.h"
 
 // Forward declarations
-class Sprite;
 
 class Image : public Widget {
  public:
@@ -112,8 +112,10 @@ class Image : public Widget {
   int32_t getFrameCount() const;
 
  protected:
-  // Holds sprites for the Image
-  Sprite* _sprites;
+  /* Holds the frame selection state for the Image.
+   * The frame table itself is shared (owned by the RsrcMgr resource data)
+   */
+  Sprite _sprite;
 
   /* used in order to check if resource was destroyed ->
    *                                              not to destroy it twice
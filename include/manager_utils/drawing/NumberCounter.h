@@ -11,6 +11,7 @@
 #include "manager_utils/time/TimerClientSpeedAdjustable.h"
 #include "manager_utils/drawing/Image.h"
 #include "manager_utils/drawing/Text.h"
+#include "manager_utils/drawing/GlyphText.h"
 
 // Forward declarations
 
@@ -22,6 +23,19 @@ enum class NumberCounterSpeed {
   INSTANT = 0
 };
 
+/** @brief how the value of the NumberCounter is rendered
+ *
+ *  TEXT        - a Text, re-rasterized on every value change
+ *  DIGIT_STRIP - glyphs from a shared GlyphAtlas (the digits and the
+ *                separators are rasterized once per font and color).
+ *                Value changes cost no rasterization and no texture
+ *                upload. Text scaling is not supported in this mode.
+ * */
+enum class NumberCounterRenderMode {
+  TEXT,
+  DIGIT_STRIP
+};
+
 /** @brief used to a trigger event
  *
  *  @param std::function<void(uint64_t) - callback on trigger value reached
@@ -47,6 +61,9 @@ struct NumberCounterTriggerConfig {
  *   @param int32_t     incTimerId     - timer ID for increase in credit
  *   @param int32_t     decTimerId     - timer ID for decrease in credit
  *   @param NumberCounterTriggerConfig - trigger config
+ *   @param NumberCounterRenderMode    - how the value is rendered
+ *   @param char  thousandsSeparator   - digit group separator
+ *                                       ('\0' for no separator)
  */
 struct NumberCounterConfig {
   Rectangle boundaryRect;
@@ -58,6 +75,8 @@ struct NumberCounterConfig {
   int32_t incrTimerId = 0;
   int32_t decrTimerId = 0;
   NumberCounterTriggerConfig triggerCfg;
+  NumberCounterRenderMode renderMode = NumberCounterRenderMode::TEXT;
+  char thousandsSeparator = '\0';
 };
 
 class NumberCounter: public TimerClientSpeedAdjustable {
@@ -187,12 +206,26 @@ protected:
   // value that must to show after update is end
   uint64_t _final;
 
-  // text that show current balance
+  // text that show current balance.
+  // Created, but hidden and not updated in DIGIT_STRIP mode
   Text _balanceText;
 
+  // used instead of _balanceText for NumberCounterRenderMode::DIGIT_STRIP
+  GlyphText _balanceGlyphText;
+
+  NumberCounterRenderMode _renderMode;
+
+  char _thousandsSeparator;
+
 private:
   void onTimeout(const int32_t timerId) override;
 
+  /** @brief used to format the value without heap allocations
+   *
+   *  @param char * - output buffer (at least 32 bytes big)
+   * */
+  void formatValue(char *outBuffer) const;
+
   // rectangle for number area
   Rectangle _boundaryRect;
 
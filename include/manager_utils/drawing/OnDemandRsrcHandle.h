@@ -0,0 +1,60 @@
+#ifndef MANAGER_UTILS_ONDEMANDRSRCHANDLE_H_
+#define MANAGER_UTILS_ONDEMANDRSRCHANDLE_H_
+
+/*
+ * OnDemandRsrcHandle.h
+ *
+ *  Brief: Move-only owner of a single reference to an on-demand resource.
+ *         The references are counted by the RsrcMgr: the first acquire
+ *         loads the texture, the following ones are O(1) and the last
+ *         release hands the texture to the residency (eviction) cache.
+ */
+
+// System headers
+#include <cstdint>
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward Declarations
+
+class OnDemandRsrcHandle {
+ public:
+  OnDemandRsrcHandle();
+  ~OnDemandRsrcHandle() noexcept;
+
+  OnDemandRsrcHandle(const OnDemandRsrcHandle& other) = delete;
+  OnDemandRsrcHandle& operator=(const OnDemandRsrcHandle& other) = delete;
+
+  OnDemandRsrcHandle(OnDemandRsrcHandle&& movedOther) noexcept;
+  OnDemandRsrcHandle& operator=(OnDemandRsrcHandle&& movedOther) noexcept;
+
+  /** @brief used to acquire a reference to the resource.
+   *         The currently held reference (if any) is released.
+   *
+   *  @param const uint64_t - unique resource ID
+   * */
+  void acquire(const uint64_t rsrcId);
+
+  /** @brief used to take ownership of an already acquired reference
+   *         (for example a completed RsrcMgr::loadResourceAsync() request)
+   *
+   *  @param const uint64_t - unique resource ID
+   * */
+  void adopt(const uint64_t rsrcId);
+
+  /** @brief used to release the held reference (if any)
+   * */
+  void release();
+
+  bool isValid() const { return _isValid; }
+
+  uint64_t getRsrcId() const { return _rsrcId; }
+
+ private:
+  uint64_t _rsrcId;
+  bool _isValid;
+};
+
+#endif /* MANAGER_UTILS_ONDEMANDRSRCHANDLE_H_ */
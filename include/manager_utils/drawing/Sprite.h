@@ -10,13 +10,30 @@
 
 // Own components headers
 
+/** @brief Sprite holds the frame selection state of an Image.
+ *
+ *         The frame table itself is not copied. Sprite references the
+ *         immutable frame table, owned by the RsrcMgr resource data,
+ *         which is shared between all Images created from the same rsrcId.
+ *         A private copy of the table is made only on write
+ *         (::addFrame() or ::init() with manual frames).
+ * */
 class Sprite {
  public:
   Sprite();
   ~Sprite() noexcept;
 
-  /** @brief used to load spriteData(precise frame Rectangle coordinates)
-   *                                                    from resources.bin
+  Sprite(Sprite&& movedOther);
+  Sprite& operator=(Sprite&& movedOther);
+
+  Sprite(const Sprite& other) = delete;
+  Sprite& operator=(const Sprite& other) = delete;
+
+  /** @brief used to reference the shared spriteData(precise frame Rectangle
+   *         coordinates) from resources.bin
+   *
+   *         NOTE: the frame table is not copied. It must outlive the Sprite
+   *               (the RsrcMgr resource data satisfies this requirement)
    *
    *  @param const uint64_t - unique resource ID
    *  @param const std::vector<Rectangle> & - spriteData from
@@ -24,7 +41,17 @@ class Sprite {
    * */
   void init(const uint64_t rsrcId, const std::vector<Rectangle>& spriteData);
 
-  /** @brief used to unload spriteData
+  /** @brief used to set a private (manual) frame table
+   *
+   *  @param const uint64_t    - unique resource ID
+   *  @param const Rectangle * - frame rectangles
+   *  @param const uint32_t    - rectangles count
+   * */
+  void init(const uint64_t rsrcId, const Rectangle* frameRects,
+            const uint32_t rectanglesCount);
+
+  /** @brief used to drop the frame table reference (and the private copy,
+   *         if such was made)
    * */
   void deinit();
 
@@ -48,9 +75,7 @@ class Sprite {
    *
    *  @return int32_t - total frame count
    * */
-  int32_t getFrameCount() const {
-    return static_cast<int32_t>(_spriteData.size());
-  }
+  int32_t getFrameCount() const { return _maxFrames; }
 
   /** @brief used to set next valid frame index.
    *         NOTE: if maxFrames are reached frame 0 is set.
@@ -62,9 +87,13 @@ class Sprite {
    * */
   void setPrevFrame();
 
-  /** @brief used to manually add an additional frame to the frame vector
+  /** @brief used to manually add an additional frame to the frame table
    *          Constrains: the frame rectangle must be from the
    *                       same source file image as the original frames
+   *
+   *          NOTE: the first invocation detaches the Sprite from the
+   *                shared frame table (copy on write)
+   *
    *  @const Rectangle& - new frame Rectangle dimensions
    * */
   void addFrame(const Rectangle& frameRect);
@@ -73,7 +102,7 @@ class Sprite {
    *
    *  @returns Rectangle - frame Rectangle dimensions
    * */
-  Rectangle getFrameRect() const { return _spriteData[_currFrame]; }
+  Rectangle getFrameRect() const { return _frames[_currFrame]; }
 
   /** @brief used to obtain currently set resource ID for the sprite
    *
@@ -81,10 +110,19 @@ class Sprite {
    * */
   uint64_t getFramesRsrcId() const { return _rsrcId; }
 
+  /** @brief used to check whether the Sprite references the shared frame
+   *         table or holds a private copy of it
+   *
+   *  @return bool - is frame table shared
+   * */
+  bool isFrameTableShared() const { return _ownedFrames.empty(); }
+
  private:
-  // A vector containing all frame Rectangles for the Image owner
-  // of the Sprite
-  std::vector<Rectangle> _spriteData;
+  // Points either to the shared frame table or to _ownedFrames
+  const Rectangle* _frames;
+
+  // Private frame table. Populated only on write
+  std::vector<Rectangle> _ownedFrames;
 
   int32_t _currFrame;
   int32_t _maxFrames;
@@ -9,6 +9,7 @@
 
 // Own components headers
 #include "manager_utils/drawing/Widget.h"
+#include "manager_utils/drawing/TextContent.h"
 
 // Forward Declarations
 
@@ -70,25 +71,64 @@ class Text : public Widget {
    * */
   void setTextAndColor(const char* text, const Color& color);
 
+  /** @brief asynchronous counterparts of ::create(), ::setText(),
+   *         ::setColor() and ::setTextAndColor().
+   *         The rasterization is executed later by the RsrcMgr (within its
+   *         per-frame async text budget). Until the new texture is ready
+   *         the Text keeps showing the previous one (a Text, created with
+   *         ::createAsync() is not drawn until it is ready).
+   *
+   *         NOTE: ::process() must be called every frame in order
+   *               to pick up the result.
+   *         NOTE2: a new request (sync or async) cancels the pending one.
+   * */
+  void createAsync(const uint64_t fontId,
+                   const char* text,
+                   const Color& color,
+                   const Point& pos = Points::ZERO);
+
+  void setTextAsync(const char* text);
+
+  void setColorAsync(const Color& color);
+
+  void setTextAndColorAsync(const char* text, const Color& color);
+
+  /** @brief used to pick up the result of a pending async request.
+   *         Updates the texture and the image width/height.
+   * */
+  void process();
+
+  bool isAsyncRequestPending() const { return 0 != _asyncTicket; }
+
+  /** @brief apply (draw) the text to the currently active back buffer.
+   *         A text with pending ::createAsync() is skipped.
+   * */
+  void draw() const;
+
   /** @brief used to get C-style char array to the _textContent
    *         currently being hold by the Text instance
    *
    *  @returns const char*  - text content of the Text instance
    * */
-  const char* getText() const { return _textContent; }
+  const char* getText() const { return _textContent.c_str(); }
 
  private:
   void resetInternals();
 
-  /** @brief used to make a deep copy of the input text
+  /** @brief used to drop the pending async request (if any)
    * */
-  void copyTextContent(const char* text);
+  void cancelAsyncRequest();
+
+  /** @brief used to apply new text dimensions as frame rectangle
+   * */
+  void updateFrameRect();
 
   /** Since Text header will be included a lot -> try not to
    *  include std::string. This will heavily influence the compile time
    *  for every file that includes the Text header.
+   *  Short labels are stored inline (no allocation).
    *  */
-  const char* _textContent;
+  TextContent _textContent;
 
   // Holds the font id correcposnding to the current text
   uint64_t _fontId;
@@ -96,6 +136,9 @@ class Text : public Widget {
   // The color of the text
   Color _color;
 
+  // ticket of the pending async request (0 if none)
+  uint64_t _asyncTicket;
+
   /* used in order to check if resource was destroyed ->
    *                                              not to destroy it twice
    */
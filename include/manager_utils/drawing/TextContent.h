@@ -0,0 +1,98 @@
+#ifndef MANAGER_UTILS_TEXTCONTENT_H_
+#define MANAGER_UTILS_TEXTCONTENT_H_
+
+/*
+ * TextContent.h
+ *
+ *  Brief: Small-string-optimized storage for the content of a Text.
+ *         Short strings are held inline (no allocation). Longer ones are
+ *         acquired from the WidgetAllocator. The length and the hash of
+ *         the content are cached, so the change detection is O(1) when
+ *         the lengths or the hashes differ.
+ */
+
+// System headers
+#include <cstdint>
+#include <cstddef>
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward Declarations
+
+class TextContent {
+ public:
+  // inline capacity (including the null terminator)
+  static constexpr size_t INLINE_CAPACITY = 24;
+
+  TextContent();
+  ~TextContent() noexcept;
+
+  TextContent(const TextContent& other) = delete;
+  TextContent& operator=(const TextContent& other) = delete;
+
+  TextContent(TextContent&& movedOther) noexcept;
+  TextContent& operator=(TextContent&& movedOther) noexcept;
+
+  /** @brief used to compute the length and the hash of a C-style string
+   *         with a single pass
+   *
+   *  @param const char * - input string
+   *  @param size_t &     - output length (without the null terminator)
+   *
+   *  @return uint64_t    - the hash (FNV-1a)
+   * */
+  static uint64_t computeHash(const char* text, size_t& outLength);
+
+  /** @brief used to make a deep copy of the input text.
+   *         The input text is allowed to point to the current content.
+   *
+   *  @param const char * - input text
+   * */
+  void assign(const char* text);
+
+  /** @brief same as ::assign(), but with already computed length and hash
+   * */
+  void assign(const char* text, const size_t length, const uint64_t hash);
+
+  /** @brief used to check whether the content matches the input text.
+   *         strcmp() is only executed if both lengths and hashes match.
+   * */
+  bool equals(const char* text, const size_t length,
+              const uint64_t hash) const;
+
+  bool equals(const char* text) const;
+
+  bool equals(const TextContent& other) const;
+
+  /** @brief used to free the heap buffer (if any) and empty the content
+   * */
+  void clear();
+
+  const char* c_str() const { return _data; }
+
+  size_t size() const { return _length; }
+
+  uint64_t hash() const { return _hash; }
+
+  bool empty() const { return 0 == _length; }
+
+  bool isInline() const { return _data == _inlineBuffer; }
+
+ private:
+  void releaseHeapBuffer();
+
+  // points either to _inlineBuffer or to a WidgetAllocator buffer
+  char* _data;
+
+  // usable bytes behind _data (including the null terminator)
+  size_t _capacity;
+
+  size_t _length;
+  uint64_t _hash;
+
+  char _inlineBuffer[INLINE_CAPACITY];
+};
+
+#endif /* MANAGER_UTILS_TEXTCONTENT_H_ */
@@ -2,6 +2,9 @@
 #define MANAGER_UTILS_DRAWMGR_H_
 
 // System headers
+#include <functional>
+#include <mutex>
+#include <vector>
 
 // Other libraries headers
 #include "sdl_utils/drawing/defines/RendererDefines.h"
@@ -12,6 +15,12 @@
 // Own components headers
 #include "manager_utils/managers/MgrBase.h"
 #include "manager_utils/managers/config/DrawMgrConfig.h"
+#include "manager_utils/managers/helpers/RendererStateCmdCoalescer.h"
+#include "manager_utils/managers/helpers/FramePacer.h"
+#include "manager_utils/managers/helpers/FrameStatsCollector.h"
+#include "manager_utils/managers/helpers/MailboxRenderQueue.h"
+#include "manager_utils/managers/helpers/AsyncScreenshotQueue.h"
+#include "manager_utils/managers/helpers/RenderTraceRecorder.h"
 
 // Forward declarations
 class SDLContainers;
@@ -158,6 +167,69 @@ public:
    * */
   void addRendererData(const uint8_t *data, const uint64_t bytes);
 
+  /** @brief used to change the blend mode of a texture.
+   *
+   *         NOTE: the command is not sent immediately. Only the last
+   *               requested blend mode per texture for the current frame
+   *               is sent to the renderer and requests that do not change
+   *               the current renderer state are dropped.
+   *
+   *  @param const WidgetType - IMAGE, TEXT or SPRITE_BUFFER
+   *  @param const uint64_t   - rsrcId for WidgetType::IMAGE or
+   *                            textId/spriteBufferId for the others
+   *  @param const BlendMode  - requested blend mode
+   * */
+  void changeTextureBlendMode(const WidgetType widgetType,
+                              const uint64_t containerId,
+                              const BlendMode blendMode);
+
+  /** @brief used to change the opacity of a unique texture
+   *                                               (TEXT or SPRITE_BUFFER)
+   *
+   *         NOTE: the command is not sent immediately. Only the last
+   *               requested opacity per texture for the current frame
+   *               is sent to the renderer and requests that do not change
+   *               the current renderer state are dropped.
+   *
+   *  @param const WidgetType - TEXT or SPRITE_BUFFER
+   *  @param const uint64_t   - textId/spriteBufferId
+   *  @param const int32_t    - requested opacity
+   * */
+  void changeTextureOpacity(const WidgetType widgetType,
+                            const uint64_t containerId, const int32_t opacity);
+
+  /** @brief used to inform the DrawMgr that a texture was created.
+   *         It is recorded in the render trace (if started), so the
+   *         replay could substitute it with a texture of the same size
+   *
+   *  @param const WidgetType - IMAGE, TEXT or SPRITE_BUFFER
+   *  @param const uint64_t   - rsrcId/textId/spriteBufferId
+   *  @param const int32_t    - texture width
+   *  @param const int32_t    - texture height
+   * */
+  void onTextureCreated(const WidgetType widgetType,
+                        const uint64_t containerId, const int32_t width,
+                        const int32_t height);
+
+  /** @brief used to inform the DrawMgr that a texture was re-created
+   *         (for example on text reload), so the renderer state cached
+   *         for it is no longer trusted
+   *
+   *  @param const WidgetType - IMAGE, TEXT or SPRITE_BUFFER
+   *  @param const uint64_t   - rsrcId/textId/spriteBufferId
+   * */
+  void onTextureRecreated(const WidgetType widgetType,
+                          const uint64_t containerId);
+
+  /** @brief used to inform the DrawMgr that a texture was destroyed,
+   *         so no stale state change commands are sent for it
+   *
+   *  @param const WidgetType - IMAGE, TEXT or SPRITE_BUFFER
+   *  @param const uint64_t   - rsrcId/textId/spriteBufferId
+   * */
+  void onTextureDestroyed(const WidgetType widgetType,
+                          const uint64_t containerId);
+
   /** @brief used to swap the command back buffers
    *                       (swap the update and rendering thread targets)
    *
@@ -180,6 +252,52 @@ public:
   void takeScreenshot(const char *file, const ScreenshotContainer container,
                       const int32_t quality);
 
+  /** @brief non-blocking variant of ::takeScreenshot().
+   *         The request is queued and issued to the renderer from
+   *         ::process() - at most one screenshot per frame.
+   *         The callback is invoked from ::process() (update thread) once
+   *         the renderer is guaranteed to have executed the request.
+   *
+   *  @param const char*               - file path
+   *  @param const ScreenshotContainer - type of container [PNG, JPG, ...]
+   *  @param const int32_t             - quality (applied only for JPG)
+   *                                     range: [0, 100], worst(0) - best(100)
+   *  @param const ScreenshotDoneCb &  - completion callback (optional)
+   *
+   *  @return ErrorCode - FAILURE if too many requests are pending
+   *
+   *  NOTE: the readback and encoding are still performed by the renderer
+   *        (on the render thread for RendererPolicy::MULTI_THREADED),
+   *        because it only supports file output. The removal of stale
+   *        files, the validation and the move of the written file to
+   *        its final path run on a worker thread.
+   *        Combined with RenderQueueMode::MAILBOX the update thread is
+   *        never blocked by a screenshot.
+   * */
+  ErrorCode takeScreenshotAsync(
+      const char *file, const ScreenshotContainer container,
+      const int32_t quality,
+      const AsyncScreenshotQueue::ScreenshotDoneCb &doneCb = nullptr);
+
+  /** @brief used to start recording the command stream (draw commands,
+   *         renderer commands/data and frame boundaries) into a binary
+   *         trace file, which could later be replayed headless by the
+   *         render_trace_replay tool
+   *
+   *  @param const char * - trace file path
+   *
+   *  @return ErrorCode - error code
+   * */
+  ErrorCode startTraceRecording(const char *file);
+
+  /** @brief used to flush and close the trace file
+   * */
+  void stopTraceRecording();
+
+  bool isTraceRecording() const {
+    return _traceRecorder.isRecording();
+  }
+
   /** @brief used to monitor the number of widgets
    *                              currently being drawn by the renderer
    *
@@ -187,9 +305,73 @@ public:
    * */
   uint32_t getTotalWidgetCount() const;
 
+  /** @brief used to acquire the number of finished frames (returned
+   *         ::finishFrame() calls). Useful for deferring the destruction
+   *         of textures that could still be referenced by queued commands
+   *
+   *  @returns uint64_t - finished frames count
+   * */
+  uint64_t getFinishedFramesCount() const {
+    return _finishedFramesCount;
+  }
+
+  /** @brief used to acquire the statistics of the last finished frame
+   *
+   *  @returns const FrameStats & - last frame statistics
+   * */
+  const FrameStats &getLastFrameStats() const {
+    return _frameStats.getLastFrameStats();
+  }
+
+  /** @brief used to acquire the statistics for the last
+   *         DrawMgrConfig::frameStatsHistorySize frames
+   *
+   *  @param std::vector<FrameStats> & - the history ordered from
+   *                                     the oldest to the newest frame
+   * */
+  void getFrameStatsHistory(std::vector<FrameStats> &outHistory) const {
+    _frameStats.getHistory(outHistory);
+  }
+
+  /** @brief used to acquire exclusive access to the Renderer update
+   *         thread API for code that calls it directly (e.g. the
+   *         SDLContainers text/Fbo creation functions).
+   *
+   *         NOTE: only needed for RenderQueueMode::MAILBOX.
+   *               For RenderQueueMode::DOUBLE_BUFFERED an empty
+   *               (not owning) lock is returned.
+   *
+   *  @return std::unique_lock<std::mutex> - the held lock
+   * */
+  std::unique_lock<std::mutex> acquireRendererLock() const;
+
+  /** @brief used to execute an operation that destroys (or streams in)
+   *         renderer resources after the already issued draw commands.
+   *
+   *         RenderQueueMode::DOUBLE_BUFFERED - executed immediately.
+   *         RenderQueueMode::MAILBOX - recorded in the frame stream and
+   *                executed by the submit thread (holding the renderer
+   *                lock), once the frames that could still draw the
+   *                resources are submitted.
+   *
+   *  @param const std::function<void()> & - the operation
+   * */
+  void addResourceOp(const std::function<void()> &op);
+
+  /** @brief used to acquire the total number of dropped frames for
+   *         RenderQueueMode::MAILBOX (0 for RenderQueueMode::DOUBLE_BUFFERED)
+   *
+   *  @return uint64_t - dropped frames count
+   * */
+  uint64_t getDroppedFramesCount() const;
+
   /** @brief used to unlock renderer (for more information check
    *                ::unlockRenderer() in thirdparty/sdlutils/Renderer.h)
    *
+   *         NOTE: for RenderQueueMode::MAILBOX the request is recorded.
+   *               The lock state is validated on record, so the
+   *               returned error code is still meaningful.
+   *
    *  @return ErrorCode - error code
    * */
   ErrorCode unlockRenderer();
@@ -206,11 +388,11 @@ public:
    *         is reached, the thread that executes the drawing is put
    *                                                             to sleep
    *
-   *  @param const uint32_t - max frame cap
+   *         NOTE: the wait is performed at the end of ::finishFrame()
+   *
+   *  @param const uint32_t - max frame cap. 0 means uncapped
    * */
-  void setMaxFrameRate(const uint32_t maxFrames) {
-    _maxFrames = maxFrames;
-  }
+  void setMaxFrameRate(const uint32_t maxFrames);
 
   /** @brief used to acquire the _maxFrames rate, which was set
    *
@@ -220,6 +402,32 @@ public:
     return _maxFrames;
   }
 
+  /** @brief used to choose how the frame rate cap is reached
+   *
+   *  @param const FramePacingMode - LOW_LATENCY (sleep + spin) or
+   *                                 POWER_SAVING (sleep only)
+   * */
+  void setFramePacingMode(const FramePacingMode mode) {
+    _framePacer.setMode(mode);
+  }
+
+  FramePacingMode getFramePacingMode() const {
+    return _framePacer.getMode();
+  }
+
+  /** @brief used to acquire frame timing statistics (frame time, jitter,
+   *         missed deadlines) since the last ::resetFramePacingStats() call
+   *
+   *  @return FramePacingStats - the gathered statistics
+   * */
+  FramePacingStats getFramePacingStats() const {
+    return _framePacer.getStats();
+  }
+
+  void resetFramePacingStats() {
+    _framePacer.resetStats();
+  }
+
   /** @brief used to acquire screen width
    *
    *  @return int32_t - screen width
@@ -242,6 +450,14 @@ public:
 
   void resetAbsoluteGlobalMovement();
 
+  /** @brief used to acquire the Renderer (e.g. for the SDLContainers)
+   *
+   *         WARNING: for RenderQueueMode::MAILBOX the Renderer update
+   *                  thread API is shared with the submit thread.
+   *                  Invoke it only while holding ::acquireRendererLock()
+   *
+   *  @return Renderer * - the renderer
+   * */
   Renderer* getRenderer() {
     return _renderer;
   }
@@ -253,11 +469,20 @@ public:
   RendererPolicy getRendererPolicy() const;
 
 private:
+  void submitRendererCmd(const RendererCmd rendererCmd, const uint8_t *data,
+                         const uint64_t bytes);
+
+  void processScreenshots();
+
   // Hide renderer implementation under user defined renderer class.
   // On later stages renderer internal implementation could be switched
   // to OPEN_GL one
   Renderer *_renderer;
 
+  // Records and submits the frames for RenderQueueMode::MAILBOX.
+  // nullptr for RenderQueueMode::DOUBLE_BUFFERED
+  MailboxRenderQueue *_mailboxQueue;
+
   // The window we'll be rendering to
   MonitorWindow _window;
 
@@ -265,6 +490,38 @@ private:
   uint32_t _maxFrames;
 
   DrawMgrConfig _config;
+
+  // Holds the texture state commands for the current frame
+  RendererStateCmdCoalescer _stateCmdCoalescer;
+
+  // Enforces the _maxFrames cap
+  FramePacer _framePacer;
+
+  // mutable, because draw commands are counted from const ::addDrawCmd()
+  mutable FrameStatsCollector _frameStats;
+
+  RendererStateCmdCoalescer::SubmitCmdCb _submitStateCmdCb;
+
+  uint64_t _lastDroppedFramesCount;
+
+  // reused storage for the RenderQueueMode::MAILBOX completed frames
+  std::vector<MailboxRenderQueue::FrameRenderTime> _completedRenderTimes;
+
+  // Holds the ::takeScreenshotAsync() requests
+  AsyncScreenshotQueue _screenshotQueue;
+
+  // mutable, because draw commands are recorded from const ::addDrawCmd()
+  mutable RenderTraceRecorder _traceRecorder;
+
+  // number of returned ::finishFrame() calls
+  uint64_t _finishedFramesCount;
+
+  // _finishedFramesCount value when the last async screenshot was issued
+  uint64_t _lastScreenshotFrame;
+
+  // the renderer lock state for RenderQueueMode::MAILBOX, where the
+  // lock/unlock requests are only recorded on the update thread
+  bool _isRendererLocked;
 };
 
 extern DrawMgr *gDrawMgr;
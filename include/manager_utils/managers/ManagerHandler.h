@@ -4,11 +4,16 @@
 //System headers
 #include <cstdint>
 #include <string>
+#include <vector>
 
 //Other libraries headers
 #include "utils/ErrorCode.h"
 
 //Own components headers
+#include "manager_utils/managers/defines/ManagerTiming.h"
+#include "manager_utils/managers/defines/StartupTimeline.h"
+#include "manager_utils/managers/helpers/ProcessTimingHistory.h"
+#include "manager_utils/managers/helpers/StartupProfiler.h"
 
 //Forward declarations
 class MgrBase;
@@ -16,9 +21,12 @@ struct ManagerHandlerConfig;
 
 namespace Managers {
 enum Indexes {
-  DRAW_MGR_IDX, RSRC_MGR_IDX, TIMER_MGR_IDX,
+  DRAW_MGR_IDX, RSRC_MGR_IDX, TIMER_MGR_IDX, SOUND_MGR_IDX,
 
-  TOTAL_MGRS_COUNT
+  TOTAL_MGRS_COUNT,
+
+  //managers, added with ManagerHandler::registerManager()
+  CUSTOM_MGR_IDX = TOTAL_MGRS_COUNT
 };
 }
 
@@ -33,14 +41,74 @@ public:
   /** @brief used to process tall the engine managers (poll them on every
    *         engine cycle so the managers can do any internal updates, if
    *                                                     such are needed).
+   *         Managers with a process rate are skipped until they are due.
    * */
   void process();
 
+  /** @brief used to add a manager, which is not part of the
+   *         ManagerHandlerConfig. The manager is initialized right away,
+   *         processed after the already registered ones and deinitialized
+   *         before them.
+   *         NOTE: must be called after ::init()
+   *
+   *  @param MgrBase *      - the manager. The ownership is transferred
+   *                          (it is deleted on ::deinit() or on failure)
+   *  @param const uint32_t - ::process() rate in Hz. 0 means on every
+   *                          ManagerHandler::process() call
+   *
+   *  @return ErrorCode - error code
+   * */
+  ErrorCode registerManager(MgrBase *manager, const uint32_t processRateHz = 0);
+
+  /** @brief used to acquire the timeline of the last ::init() call
+   *         (when each manager was initialized and for how long)
+   * */
+  const StartupTimeline &getStartupTimeline() const {
+    return _startupTimeline;
+  }
+
+  /** @brief used to acquire the ::process() timings of all managers
+   *         in their registration order
+   *
+   *  @param std::vector<ManagerTiming> & - the populated timings
+   * */
+  void getManagerTimings(std::vector<ManagerTiming> &outTimings) const;
+
+  void logManagerTimings() const;
+
+  /** @brief used to change the ::process() time budget
+   *
+   *  @param const int64_t - budget in microseconds. 0 disables it
+   * */
+  void setFrameBudget(const int64_t budgetUs) {
+    _frameBudgetUs = budgetUs;
+  }
+
   //================== END engine interface functions ====================
 
 private:
+  struct ManagerEntry {
+    MgrBase *manager = nullptr;
+
+    //Managers::Indexes value
+    int32_t managerIdx = Managers::CUSTOM_MGR_IDX;
+
+    //0 means on every ::process() call
+    int64_t processIntervalUs = 0;
+    int64_t nextProcessUs = 0;
+
+    ProcessTimingHistory timingHistory;
+    uint64_t overrunsCount = 0;
+
+    //the budget overruns are logged at most once per interval
+    int64_t nextOverrunLogUs = 0;
+  };
+
   ErrorCode allocateManagers(const ManagerHandlerConfig &cfg);
 
+  void addManagerEntry(MgrBase *manager, const int32_t managerIdx,
+                       const uint32_t processRateHz);
+
   /** @brief used to reset the global manager pointer to nullptr at deinit
    *         so sanity checks could catch possible failures on system
    *         deinit
@@ -49,11 +117,38 @@ private:
    * */
   void nullifyGlobalManager(const int32_t managerId);
 
-  /** A container for all managers. We use polymorphical approach
-   * so we can iterate it more easily
+  /** @brief used to stop the startup profiling and write the profile.
+   *         Invoked on the first ::process()
    * */
-  MgrBase *_managers[Managers::TOTAL_MGRS_COUNT];
+  void finishStartupProfile();
+
+  /** @brief used to append the recorded trace events to the trace file
+   *         once the flush interval elapses
+   *
+   *  @param const int64_t - current time in microseconds
+   * */
+  void flushTraceIfDue(const int64_t nowUs);
+
+  /** A registry for all managers in their init order. We use polymorphical
+   * approach so we can iterate it more easily
+   * */
+  std::vector<ManagerEntry> _managers;
+
+  StartupTimeline _startupTimeline;
+
+  //0 means no budget
+  int64_t _frameBudgetUs = 0;
+  uint32_t _timingHistorySize = 0;
+
+  StartupProfiler _startupProfiler;
+  std::string _startupProfileFile;
+
+  //empty means no tracing
+  std::string _traceFile;
+
+  //0 means flush only on ::deinit()
+  int64_t _traceFlushIntervalUs = 0;
+  int64_t _nextTraceFlushUs = 0;
 };
 
 #endif /* MANAGER_UTILS_MANAGERHANDLER_H_ */
-
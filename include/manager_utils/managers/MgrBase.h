@@ -47,6 +47,19 @@ class MgrBase : public NonCopyable, public NonMoveable {
    * */
   virtual void process() = 0;
 
+  /** @brief used to process the current manager within a time slice of
+   *         the frame budget. Managers with deferrable work (such as
+   *         timer callbacks or resource streaming) should leave the
+   *         remaining work for the next frame, once the slice is consumed.
+   *
+   *         NOTE: by default the slice is ignored and ::process() is called
+   *
+   *  @param const int64_t - time slice in microseconds
+   * */
+  virtual void processWithinBudget([[maybe_unused]]const int64_t budgetUs) {
+    process();
+  }
+
   /** @brief captures user inputs (if any)
    *
    *  @param const InputEvent & - user input event
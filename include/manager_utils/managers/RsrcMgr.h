@@ -3,15 +3,26 @@
 
 // System headers
 #include <cstdint>
+#include <functional>
+#include <mutex>
+#include <utility>
+#include <vector>
 
 // Other libraries headers
 #include "sdl_utils/containers/SDLContainers.h"
 
 // Own components headers
 #include "manager_utils/managers/MgrBase.h"
+#include "manager_utils/managers/helpers/GlyphAtlasCache.h"
+#include "manager_utils/managers/helpers/TextTextureCache.h"
+#include "manager_utils/managers/helpers/AsyncTextQueue.h"
+#include "manager_utils/managers/helpers/ResourceStreamer.h"
+#include "manager_utils/managers/helpers/TextureResidencyCache.h"
+#include "manager_utils/trace/Tracer.h"
 
 // Forward declarations
 class InputEvent;
+class GlyphAtlas;
 
 class RsrcMgr final : public MgrBase, public SDLContainers {
  public:
@@ -51,6 +62,16 @@ class RsrcMgr final : public MgrBase, public SDLContainers {
    * */
   void process() override;
 
+  /** @brief used to process the current manager within a time slice.
+   *         The async text rasterization is limited to the slice and
+   *         once the slice is consumed only the most urgent resource
+   *         streaming upload is dispatched. The rest are deferred to the
+   *         next process call.
+   *
+   *  @param const int64_t - time slice in microseconds
+   * */
+  void processWithinBudget(const int64_t budgetUs) override;
+
   /** @brief captures user inputs (if any)
    *
    *  @param const InputEvent & - user input event
@@ -88,6 +109,286 @@ class RsrcMgr final : public MgrBase, public SDLContainers {
    *  @return uint64_t - occupied VRAM in bytes
    * */
   uint64_t getGPUMemoryUsage() const;
+
+  /** @brief used to acquire the shared glyph atlas for a font and color.
+   *         The atlas is built on the first acquire.
+   *
+   *  @param const uint64_t - unique font ID
+   *  @param const Color &  - glyphs color
+   *
+   *  @return GlyphAtlas *  - the atlas (nullptr on failure)
+   * */
+  GlyphAtlas *acquireGlyphAtlas(const uint64_t fontId, const Color &color);
+
+  /** @brief used to release an atlas, acquired with ::acquireGlyphAtlas().
+   *         The atlas is destroyed on the last release.
+   *
+   *  @param const GlyphAtlas * - the atlas
+   * */
+  void releaseGlyphAtlas(const GlyphAtlas *atlas);
+
+  /** @brief used to request a text rasterization, which is executed
+   *         later from ::process() (within the async text time budget)
+   *
+   *  @param const uint64_t - unique font ID
+   *  @param const char *   - text content
+   *  @param const Color &  - text color
+   *
+   *  @return uint64_t      - ticket for ::pollTextAsync()
+   * */
+  uint64_t loadTextAsync(const uint64_t fontId, const char *text,
+                         const Color &color);
+
+  /** @brief used to acquire the result of a ::loadTextAsync() request.
+   *         On completion the caller owns the text (::unloadText()).
+   *
+   *  @param const uint64_t    - request ticket
+   *  @param AsyncTextResult & - the result
+   *
+   *  @return bool - is the request completed
+   * */
+  bool pollTextAsync(const uint64_t ticket, AsyncTextResult &outResult);
+
+  /** @brief used to drop a ::loadTextAsync() request
+   *
+   *  @param const uint64_t - request ticket
+   * */
+  void cancelTextAsync(const uint64_t ticket);
+
+  /** @brief used to set the time, which ::process() may spend on
+   *         async text rasterization per call
+   *
+   *  @param const int64_t - time budget in microseconds
+   * */
+  void setAsyncTextBudget(const int64_t budgetUs) {
+    _asyncTextBudgetUs = budgetUs;
+  }
+
+  /** @brief used to request a prioritized asynchronous load of an
+   *         on-demand resource. The decode is executed by the
+   *         SDLContainers worker threads and the GPU upload by the
+   *         drawing thread (within the streaming upload budget).
+   *
+   *  @param const uint64_t - unique resource ID
+   *  @param const int32_t  - priority (higher is loaded first)
+   *  @param const int64_t  - deadline in milliseconds from now. Overdue
+   *                          requests are dispatched regardless of the
+   *                          budget (NO_STREAM_DEADLINE for none)
+   *
+   *  @return uint64_t      - ticket for ::pollResourceAsync()
+   * */
+  uint64_t loadResourceAsync(const uint64_t rsrcId, const int32_t priority,
+                             const int64_t deadlineMs = NO_STREAM_DEADLINE);
+
+  /** @brief used to acquire the state of a ::loadResourceAsync() request.
+   *         On READY the caller owns a reference to the resource
+   *         (::unloadResourceOnDemandSingle()).
+   *         READY and FAILED results are consumed.
+   *
+   *  @param const uint64_t - request ticket
+   *
+   *  @return StreamRequestState - state of the request
+   * */
+  StreamRequestState pollResourceAsync(const uint64_t ticket);
+
+  /** @brief used to drop a ::loadResourceAsync() request
+   *
+   *  @param const uint64_t - request ticket
+   * */
+  void cancelResourceAsync(const uint64_t ticket);
+
+  /** @brief used to set the texture bytes, which ::process() may
+   *         dispatch for upload per call
+   *
+   *  @param const uint64_t - upload budget in bytes
+   * */
+  void setStreamingUploadBudget(const uint64_t budgetBytes) {
+    _streamingUploadBudgetBytes = budgetBytes;
+  }
+
+  /** @brief used to set the VRAM budget for the resident on-demand
+   *         textures. Not referenced textures are evicted (least recently
+   *         used first) while the budget is exceeded.
+   *
+   *  @param const uint64_t - VRAM budget in bytes
+   * */
+  void setVramBudget(const uint64_t vramBudgetBytes);
+
+  /** @brief used to acquire the reference count of an on-demand
+   *         resource (0 if not referenced)
+   *
+   *  @param const uint64_t - unique resource ID
+   *
+   *  @return uint32_t      - reference count
+   * */
+  uint32_t getOnDemandRefCount(const uint64_t rsrcId) const;
+
+  /** @brief used to collect every referenced on-demand resource with
+   *         its reference count. Intended for leak debugging
+   *
+   *  @param std::vector<std::pair<uint64_t, uint32_t>> &
+   *                                             - (rsrcId, refCount) pairs
+   * */
+  void collectOnDemandRefCounts(
+      std::vector<std::pair<uint64_t, uint32_t>> &outRefCounts) const;
+
+  /** @brief used to acquire the on-demand texture residency statistics
+   *         (including the referenced textures and references counts)
+   * */
+  TextureResidencyStats getTextureResidencyStats() const {
+    return _residencyCache.getStats();
+  }
+
+  /** @brief used to give a text a private (not shared) texture, so its
+   *         texture state (blend mode, opacity) could be changed without
+   *         affecting the other identical texts.
+   *
+   *  @param int32_t & - unique text ID. Changed if a private copy is loaded
+   * */
+  void makeTextUnique(int32_t &textId);
+
+  /** @brief used to set how many not referenced texts are kept loaded
+   *         for reuse
+   *
+   *  @param const uint32_t - max retained texts
+   * */
+  void setMaxRetainedTexts(const uint32_t maxRetainedTexts);
+
+  /** @brief used to acquire the text cache statistics (hit rate,
+   *         saved texture bytes, etc.)
+   * */
+  TextCacheStats getTextCacheStats() const {
+    return _textCache.getStats();
+  }
+
+  //============= START SDLContainers renderer facing functions ============
+  /** The functions below hide their SDLContainers counterparts in order
+   *  to serialize the direct Renderer access with the DrawMgr frame
+   *  submission (needed for RenderQueueMode::MAILBOX).
+   *  Functions that destroy textures record the destruction as a
+   *  resource operation (::addResourceOp()), so it executes only after
+   *  the already recorded frames, that could still reference them.
+   * */
+
+  /** Texts are shared through a reference counted cache, keyed by
+   *  (fontId, content hash, color). Identical texts use a single texture.
+   *  ::reloadText() may change the textId (it switches the reference to
+   *  an already cached text with the new content/color or loads a new
+   *  texture, if the current one is shared with other texts).
+   * */
+  ErrorCode loadText(const uint64_t fontId, const char *text,
+                     const Color &color, int32_t &outTextId,
+                     int32_t &outTextWidth, int32_t &outTextHeight);
+
+  void reloadText(const uint64_t fontId, const char *text, const Color &color,
+                  int32_t &textId, int32_t &outTextWidth,
+                  int32_t &outTextHeight);
+
+  void unloadText(const int32_t textId);
+
+  template <typename... Args>
+  decltype(auto) createFbo(Args &&... args) {
+    const TraceZone zone("RsrcMgr::createFbo");
+    const auto lock = acquireRendererLock();
+    return SDLContainers::createFbo(std::forward<Args>(args)...);
+  }
+
+  /** The Fbo is destroyed after the already issued draw commands
+   *  (for RenderQueueMode::MAILBOX - once they are submitted)
+   * */
+  template <typename... Args>
+  void destroyFbo(Args &&... args) {
+    addResourceOp([this, args...]() {
+      SDLContainers::destroyFbo(args...);
+    });
+  }
+
+  /** On-demand textures are reference counted by the RsrcMgr. The first
+   *  load of a resource loads the texture, the following loads are O(1).
+   *  The last unload hands the texture to a residency cache. Textures that
+   *  are no longer referenced stay loaded (LRU) while the resident
+   *  on-demand textures fit in the VRAM budget (::setVramBudget()).
+   *  ::loadResourceOnDemandSingle() of a texture, that an in-flight
+   *  ::loadResourceOnDemandMultiple() batch is still uploading, loads it
+   *  synchronously.
+   *  Prefer OnDemandRsrcHandle over calling these directly.
+   * */
+  void loadResourceOnDemandSingle(const uint64_t rsrcId);
+
+  void unloadResourceOnDemandSingle(const uint64_t rsrcId);
+
+  void loadResourceOnDemandMultiple(const std::vector<uint64_t> &rsrcIds,
+                                    const int32_t batchId);
+
+  void unloadResourceOnDemandMultiple(const std::vector<uint64_t> &rsrcIds);
+
+  //============== END SDLContainers renderer facing functions =============
+
+private:
+  std::unique_lock<std::mutex> acquireRendererLock() const;
+
+  void addResourceOp(const std::function<void()> &op);
+
+  void unloadTexts(const std::vector<int32_t> &textIds);
+
+  void onTextCreated(const int32_t textId, const int32_t width,
+                     const int32_t height);
+
+  /** @brief used to reset the committed texture state (blend mode and
+   *         opacity) of an on-demand image, whose texture is (re)loaded
+   *         or unloaded
+   * */
+  void onImageLoaded(const uint64_t rsrcId);
+
+  void onImageUnloaded(const uint64_t rsrcId);
+
+  uint64_t getRsrcTextureBytes(const uint64_t rsrcId);
+
+  void enforceVramBudget();
+
+  /** @brief used to mark the textures of the completed load batches as
+   *         resident and to complete the batches that waited for them
+   * */
+  void applyCompletedLoadBatches();
+
+  void completeLoadBatch(const int32_t batchId);
+
+  struct LoadBatch {
+    std::vector<uint64_t> rsrcIds;
+    int32_t batchId = 0;
+  };
+
+  GlyphAtlasCache _glyphAtlasCache;
+
+  TextTextureCache _textCache;
+
+  // reused between the ::unloadText() calls
+  std::vector<int32_t> _unloadTextIds;
+
+  AsyncTextQueue _asyncTextQueue;
+
+  int64_t _asyncTextBudgetUs;
+
+  ResourceStreamer _resourceStreamer;
+
+  uint64_t _streamingUploadBudgetBytes;
+
+  TextureResidencyCache _residencyCache;
+
+  // reused between the on-demand load/unload calls
+  std::vector<uint64_t> _rsrcIdsToProcess;
+
+  // dispatched batches with the textures, which they load
+  std::vector<LoadBatch> _loadingBatches;
+
+  // not yet completed batches with the textures, they still wait for
+  // (loaded by them or by other in-flight batches)
+  std::vector<LoadBatch> _waitingBatches;
+
+  // batch completions could be reported from any thread
+  std::mutex _completedLoadBatchesMutex;
+  std::vector<int32_t> _completedLoadBatches;
+  std::vector<int32_t> _completedLoadBatchesCopy;
 };
 
 extern RsrcMgr* gRsrcMgr;
@@ -3,11 +3,16 @@
 
 // System headers
 #include <cstdint>
+#include <deque>
 
 // Other libraries headers
 #include "resource_utils/defines/SoundDefines.h"
 
 // Own components headers
+#include "manager_utils/managers/config/SoundMgrConfig.h"
+#include "manager_utils/managers/defines/SoundMgrDefines.h"
+#include "manager_utils/managers/helpers/SoundTriggerLimiter.h"
+#include "manager_utils/managers/helpers/VoicePool.h"
 #include "manager_utils/managers/MgrBase.h"
 
 // Forward declarations
@@ -17,7 +22,7 @@ typedef struct _Mix_Music Mix_Music;
 
 class SoundMgr final : public MgrBase {
  public:
-  SoundMgr();
+  explicit SoundMgr(const SoundMgrConfig &cfg = SoundMgrConfig());
   virtual ~SoundMgr() noexcept;
 
   //================= START MgrBase related functions ====================
@@ -70,6 +75,23 @@ class SoundMgr final : public MgrBase {
    * */
   SoundLevel getGlobalVolumeLevel() const { return _systemSoundLevel; }
 
+  /** @brief used to acquire the voices usage and stealing statistics
+   *
+   *  @return const VoicePoolStats & - the statistics
+   * */
+  const VoicePoolStats& getVoicePoolStats() const {
+    return _voicePool.getStats();
+  }
+
+  /** @brief used to acquire the started, merged and dropped plays
+   *         statistics for all sound chunks
+   *
+   *  @return const SoundTriggerStats & - the statistics
+   * */
+  const SoundTriggerStats& getTriggerStats() const {
+    return _triggerLimiter.getTotalStats();
+  }
+
   //=================== START Music related functions ====================
 
   /** @brief used to load music sound from rsrcId so it can
@@ -186,13 +208,19 @@ class SoundMgr final : public MgrBase {
    *         NOTE: this function does not return error code
    *                                              for performance reasons
    *
-   *  @param const uint64_t     - unique resource ID
-   *  @param const int32_t      - number of repeats (-1 for
+   *         NOTE2: if all voices are busy - the oldest voice with the
+   *                lowest priority (not higher than the provided one)
+   *                is stolen
+   *
+   *  @param const uint64_t      - unique resource ID
+   *  @param const int32_t       - number of repeats (-1 for
    *                                              endless loop /~65000/ )
-   *  @param SoundWidgetEndCb * - user defined sound end callback
+   *  @param SoundWidgetEndCb *  - user defined sound end callback
+   *  @param const SoundPriority - priority of the sound
    * */
   void playChunk(const uint64_t rsrcId, const int32_t loops,
-                 SoundWidgetEndCb* endCb);
+                 SoundWidgetEndCb* endCb,
+                 const SoundPriority priority = SoundPriority::NORMAL);
 
   /** @brief used to play a specific sound chunk with panning on for
    *         it's associated channel. The left volume and right volume
@@ -211,10 +239,13 @@ class SoundMgr final : public MgrBase {
    *  @param const uint8_t      - left volume value
    *  @param const uint8_t      - right volume value
    *  @param SoundWidgetEndCb * - user defined sound end callback
+   *  @param const SoundPriority - priority of the sound
    * */
   void playChunkWithPanning(const uint64_t rsrcId, const int32_t loops,
                             const uint8_t leftVolume, const uint8_t rightVolume,
-                            SoundWidgetEndCb* endCb);
+                            SoundWidgetEndCb* endCb,
+                            const SoundPriority priority =
+                                SoundPriority::NORMAL);
 
   /** @brief used to stop a specific sound chunk from playing
    *         NOTE: this function does not return error code
@@ -278,18 +309,46 @@ class SoundMgr final : public MgrBase {
    *  @param const uint64_t - unique resource ID
    * */
   void resumeChunk(const uint64_t rsrcId);
+
+  /** @brief used to rate limit the rapid repeated plays of a sound chunk.
+   *         Overrides SoundMgrConfig::defaultPlaybackLimits for it.
+   *
+   *         NOTE: a merged play does not start a new voice, so its
+   *               SoundWidgetEndCb is not invoked
+   *
+   *  @param const uint64_t              - unique resource ID
+   *  @param const SoundPlaybackLimits & - retrigger interval and
+   *                                       maximum concurrent instances
+   * */
+  void setChunkPlaybackLimits(const uint64_t rsrcId,
+                              const SoundPlaybackLimits& limits);
+
+  /** @brief used to restore the default playback limits of a sound chunk
+   *
+   *  @param const uint64_t - unique resource ID
+   * */
+  void resetChunkPlaybackLimits(const uint64_t rsrcId);
+
+  /** @brief used to acquire the started, merged and dropped plays
+   *         statistics for a sound chunk
+   *
+   *  @param const uint64_t - unique resource ID
+   *
+   *  @return SoundTriggerStats - the statistics
+   * */
+  SoundTriggerStats getChunkTriggerStats(const uint64_t rsrcId) const;
   //==================== END Chunk related functions =====================
 
  protected:
   /** @brief used to set global volume for the whole system
    *         NOTE: internally this method changed the sound for all
-   *                                          SUPPORTED_SOUND_CHANNELS.
+   *                                                     sound channels.
    * */
   void setGlobalVolume(const SoundLevel soundLevel);
 
   /** @brief used to set global volume for the whole system
    *         NOTE: internally this method changed the sound for all
-   *                                          SUPPORTED_SOUND_CHANNELS.
+   *                                                     sound channels.
    *
    *         NOTE2: if _systemSoundLevel == SoundLevel::VERY_HIGH ->
    *                   _systemSoundLevel is set to SoundLevel::NONE
@@ -361,22 +420,46 @@ class SoundMgr final : public MgrBase {
    * */
   void resumeChannel(const int32_t channel);
 
-  /** @brief used to determine the associated sound chunk
-   *                      unique resource ID bound to the sound channel
+  /** @brief used to determine the sound channel, which is playing the
+   *         sound chunk with the provided unique resource ID.
+   *         If the chunk is played on several channels - the most
+   *         recently started one is returned
    *
-   *  @param const uint64_t - specific channel ID
+   *  @param const uint64_t - unique resource ID
    *
    *  @return int32_t       - specific channel ID (-1 for INVALID_CHANNEL)
    * */
   int32_t findAssociatedChannel(const uint64_t rsrcId) const;
 
-  /** @brief used to acquire a free sound channel
+  /** @brief used to acquire a sound channel. If none is free - the
+   *         oldest channel with the lowest priority (not higher than the
+   *         provided one) is stopped and reused. The end callback of the
+   *         stolen sound is invoked on the next ::process() call
+   *
+   *  @param const uint64_t      - unique resource ID
+   *  @param const SoundPriority - priority of the sound
    *
    *  @return int32_t - specific channel ID (-1 for INVALID_CHANNEL)
    *
    *          NOTE: the channelId 0 is reserved for Music
    * */
-  int32_t getNextFreeChannel() const;
+  int32_t acquireChannel(const uint64_t rsrcId, const SoundPriority priority);
+
+  /** @brief used to apply the playback limits of a sound chunk
+   *
+   *  @param const uint64_t - unique resource ID
+   *
+   *  @return bool - should the chunk be started on a new voice
+   * */
+  bool acceptPlayRequest(const uint64_t rsrcId);
+
+  /** @brief used to validate a channel ID
+   *
+   *  @param const int32_t - specific channel ID
+   *
+   *  @return bool - is valid or not
+   * */
+  bool isValidChannel(const int32_t channel) const;
 
   /** @brief used to reset channel (if it was occupied)
    *         NOTE: if there is SoundEndHandler attached to this channel -
@@ -388,6 +471,25 @@ class SoundMgr final : public MgrBase {
    * */
   void resetChannel(const int32_t channel);
 
+  /** @brief used to free a voice, stolen for a new sound. Unlike
+   *         ::resetChannel() its end callback is not invoked in place
+   *         (the caller is in the middle of a voice allocation). It is
+   *         deferred to the next ::process() instead
+   *
+   *  @param const int32_t specific channel ID
+   * */
+  void releaseStolenChannel(const int32_t channel);
+
+  /** @brief used to invoke the end callbacks of the stolen voices
+   * */
+  void invokeStolenChannelsEndCb();
+
+  /** @brief used to reset the busy voices, which are no longer playing.
+   *         Invoked when finished channel notifications were dropped,
+   *         because their voices would otherwise remain busy forever
+   * */
+  void recoverDroppedChannels();
+
   //=================== END Channel related functions ====================
 
   /** @brief a callback for when a sound (music or chunk) is
@@ -399,30 +501,43 @@ class SoundMgr final : public MgrBase {
 
   enum InternalDefines {
     MUSIC_RESERVED_CHANNEL_ID = 0,
-    INVALID_CHANNEL_ID = -1,
-
-    /* Holds maximum supported sound channels (number of sounds that
-     *                                    can be played simultaneously)
-     * */
-    SUPPORTED_SOUND_CHANNELS = 20
+    INVALID_CHANNEL_ID = -1
   };
 
+  /* Holds the number of sound channels (number of sounds that
+   *                                    can be played simultaneously)
+   * */
+  int32_t _voicesCount;
+
+  /* Holds the busy/free channels and their associated rsrcIds
+   * */
+  VoicePool _voicePool;
+
+  /* Merges or drops rapid repeated plays of the same chunk
+   * */
+  SoundTriggerLimiter _triggerLimiter;
+
   /* Used to mark current sound channel that has requested panning in
    * order to reset the panning, when the associated sound behind the
    * channel has finished playing.
    * */
   int32_t* _panningMap;
 
-  /** Used to map rsrcId to with his currently used
-   *                                       by the SDL_Mixer audio channel
-   * */
-  uint64_t* _usedChannels;
-
   /** Used to map SoundWidgetEndCb with his currently used
    *                                       by the SDL_Mixer audio channel
    * */
   SoundWidgetEndCb** _usedChannelsEndCb;
 
+  struct StolenChannelEndCb {
+    SoundWidgetEndCb *endCb = nullptr;
+    uint64_t rsrcId = 0;
+  };
+
+  /* Holds the end callbacks of the stolen voices, which are
+   * invoked on the next ::process() call
+   * */
+  std::deque<StolenChannelEndCb> _stolenChannelsEndCb;
+
   /* Holds the loaded music(if such).
    * Note: there can be only 1 music loaded and playing simultaneously
    * */
@@ -433,6 +548,11 @@ class SoundMgr final : public MgrBase {
 
   /* Holds the global system level of sound */
   SoundLevel _systemSoundLevel;
+
+  /* Holds the count of the dropped finished channel notifications,
+   * which were already recovered
+   * */
+  uint64_t _recoveredDroppedChannelsCount;
 };
 
 extern SoundMgr* gSoundMgr;
@@ -52,6 +52,16 @@ class TimerMgr final : public MgrBase {
    * */
   void process() override;
 
+  /** @brief used to process the current manager within a time slice.
+   *         Once the slice is consumed, the callbacks of the remaining
+   *         expired timers are deferred to the next process call, which
+   *         starts from the first deferred timer. At least one expired
+   *         timer callback is executed per call.
+   *
+   *  @param const int64_t - time slice in microseconds
+   * */
+  void processWithinBudget(const int64_t budgetUs) override;
+
   /** @brief captures user inputs (if any)
    *
    *  @param const InputEvent & - user input event
@@ -298,6 +308,15 @@ class TimerMgr final : public MgrBase {
    * */
   void onTimerTimeout(const int32_t timerId, TimerData& timerData);
 
+  /** @brief used to update the timers and execute the expired ones
+   *
+   *  @param const int64_t - time slice in microseconds for the timer
+   *                         callbacks. NO_BUDGET means unlimited
+   * */
+  void processTimers(const int64_t budgetUs);
+
+  static constexpr int64_t NO_BUDGET = -1;
+
   /** @brief used to remove timers from the _timerMap that are contained
    *                                                  in _removeTimerSet.
    * */
@@ -333,6 +352,11 @@ class TimerMgr final : public MgrBase {
    * */
   std::set<int32_t> _removeTimerSet;
 
+  /** The first timer, whose expired callback was deferred, because the
+   *  budget was consumed. The next process call starts from it
+   * */
+  int32_t _nextTimeoutTimerId;
+
   /** A flag to indicate whether the whole TimerMgr is in paused state
    * */
   bool _isTimerMgrPaused;
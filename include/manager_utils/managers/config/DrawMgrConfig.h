@@ -9,12 +9,23 @@
 #include "sdl_utils/drawing/config/MonitorWindowConfig.h"
 
 //Own components headers
+#include "manager_utils/managers/defines/FramePacingDefines.h"
+#include "manager_utils/managers/defines/RenderQueueDefines.h"
 
 //Forward declarations
 
 struct DrawMgrConfig {
   RendererConfig rendererConfig;
   MonitorWindowConfig monitorWindowConfig;
+
+  //0 means uncapped frame rate
+  uint32_t maxFrameRate = 0;
+  FramePacingMode framePacingMode = FramePacingMode::POWER_SAVING;
+
+  //number of frames kept in the FrameStats history. 0 disables the history
+  uint32_t frameStatsHistorySize = 120;
+
+  RenderQueueMode renderQueueMode = RenderQueueMode::DOUBLE_BUFFERED;
 };
 
 #endif /* MANAGER_UTILS_DRAWMGRBASECONFIG_H_ */
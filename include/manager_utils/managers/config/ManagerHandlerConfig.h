@@ -2,18 +2,64 @@
 #define MANAGER_UTILS_MANAGERHANDLERCFG_H_
 
 //System headers
+#include <cstdint>
+#include <string>
 
 //Other libraries headers
 #include "sdl_utils/containers/config/SDLContainersConfig.h"
 
 //Own components headers
 #include "manager_utils/managers/config/DrawMgrConfig.h"
+#include "manager_utils/managers/config/SoundMgrConfig.h"
 
 //Forward declarations
 
 struct ManagerHandlerConfig {
   SDLContainersConfig sdlContainersCfg;
   DrawMgrConfig drawMgrCfg;
+  SoundMgrConfig soundMgrCfg;
+
+  //optional managers. The DrawMgr and the RsrcMgr are always created.
+  //NOTE: the SoundMgr requires an opened SDL_mixer audio device
+  bool enableTimerMgr = true;
+  bool enableSoundMgr = false;
+
+  //::process() rate of the managers in Hz. 0 means on every
+  //ManagerHandler::process() call
+  uint32_t drawMgrProcessRateHz = 0;
+  uint32_t rsrcMgrProcessRateHz = 0;
+  uint32_t timerMgrProcessRateHz = 0;
+  uint32_t soundMgrProcessRateHz = 0;
+
+  //time budget for a single ManagerHandler::process() call in
+  //microseconds. Managers get the remaining part of it as their slice
+  //(check MgrBase::processWithinBudget()). 0 disables the budget
+  int64_t frameBudgetUs = 0;
+
+  //number of the most recent ::process() durations, kept per manager
+  //for the average and p99 timings
+  uint32_t managerTimingHistorySize = 120;
+
+  //Chrome trace JSON with the Tracer zones, recorded during the startup
+  //(managers init and the initial scene loading). Asset loads carry their
+  //ID. Empty disables the startup profiling
+  std::string startupProfileFile;
+
+  //how many of the slowest assets are logged after the startup
+  uint32_t startupProfileTopAssetsCount = 20;
+
+  //Chrome trace JSON for the TraceZone events of all threads.
+  //Empty disables the tracing. A previous file is replaced on ::init()
+  std::string traceFile;
+
+  //per thread ring capacity (in events) for the tracing and for the
+  //startup profile
+  uint32_t traceEventsPerThread = 64 * 1024;
+
+  //the recorded events are appended to the traceFile on this interval
+  //(from ManagerHandler::process()) and on ::deinit().
+  //0 means only on ::deinit()
+  uint32_t traceFlushIntervalMs = 1000;
 };
 
 #endif /* MANAGER_UTILS_MANAGERHANDLERCFG_H_ */
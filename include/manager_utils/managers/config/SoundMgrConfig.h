@@ -0,0 +1,24 @@
+#ifndef MANAGER_UTILS_SOUNDMGRCONFIG_H_
+#define MANAGER_UTILS_SOUNDMGRCONFIG_H_
+
+//System headers
+#include <cstdint>
+
+//Other libraries headers
+
+//Own components headers
+#include "manager_utils/managers/defines/SoundMgrDefines.h"
+
+//Forward declarations
+
+struct SoundMgrConfig {
+  //number of SDL_mixer channels (sounds that can be played simultaneously).
+  //Channel 0 is reserved for the music
+  int32_t voicesCount = 64;
+
+  //applied to every sound chunk, which has no limits of its own.
+  //Check SoundMgr::setChunkPlaybackLimits()
+  SoundPlaybackLimits defaultPlaybackLimits;
+};
+
+#endif /* MANAGER_UTILS_SOUNDMGRCONFIG_H_ */
@@ -0,0 +1,48 @@
+#ifndef MANAGER_UTILS_FRAMEPACINGDEFINES_H_
+#define MANAGER_UTILS_FRAMEPACINGDEFINES_H_
+
+// System headers
+#include <cstdint>
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+
+enum class FramePacingMode : uint8_t {
+  /* Sleep until shortly before the frame deadline and busy-wait (yielding)
+   * for the remainder. Most precise frame timing at the cost of some
+   * additional CPU usage.
+   * */
+  LOW_LATENCY,
+
+  /* Only sleep until the frame deadline. Frames could be presented a bit
+   * later due to OS scheduler granularity, but no CPU time is burned
+   * while waiting.
+   * */
+  POWER_SAVING
+};
+
+/* Frame timing statistics gathered since the last reset.
+ * All time values are in microseconds.
+ * */
+struct FramePacingStats {
+  uint64_t frameCount = 0;
+
+  // frames that took longer than the target frame time
+  uint64_t missedDeadlines = 0;
+
+  int64_t minFrameTimeUs = 0;
+  int64_t maxFrameTimeUs = 0;
+  double avgFrameTimeUs = 0.0;
+
+  // standard deviation of the frame time
+  double jitterUs = 0.0;
+
+  // total time spent in waiting for the frame deadline
+  int64_t sleepTimeUs = 0;
+  int64_t spinTimeUs = 0;
+};
+
+#endif /* MANAGER_UTILS_FRAMEPACINGDEFINES_H_ */
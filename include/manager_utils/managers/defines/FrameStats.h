@@ -0,0 +1,75 @@
+#ifndef MANAGER_UTILS_FRAMESTATS_H_
+#define MANAGER_UTILS_FRAMESTATS_H_
+
+// System headers
+#include <cstdint>
+#include <array>
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+
+/* RendererCmd values above this limit are only accumulated in
+ * FrameStats::untrackedRendererCmdCount
+ * */
+constexpr uint32_t MAX_TRACKED_RENDERER_CMDS = 32;
+
+/* Statistics for a single frame (from DrawMgr::clearScreen() to
+ * DrawMgr::finishFrame()). All time values are in microseconds.
+ * */
+struct FrameStats {
+  uint64_t frameId = 0;
+
+  // DrawMgr::addDrawCmd() calls and the DrawParams bytes they carry
+  uint32_t drawCmdCount = 0;
+  uint64_t drawCmdBytes = 0;
+
+  // bytes pushed through DrawMgr::addRendererData()
+  uint64_t rendererDataBytes = 0;
+
+  // renderer commands pushed through DrawMgr::addRendererCmd(),
+  // indexed by getEnumValue(RendererCmd).
+  // The coalesced texture state commands are counted once they are
+  // flushed to the renderer
+  uint32_t rendererCmdCount = 0;
+  uint64_t rendererCmdBytes = 0;
+  std::array<uint32_t, MAX_TRACKED_RENDERER_CMDS> rendererCmdCountByType {};
+  uint32_t untrackedRendererCmdCount = 0;
+
+  // texture state commands requested by the widgets vs. the ones
+  // that actually reached the renderer after coalescing
+  uint32_t stateCmdsReceived = 0;
+  uint32_t stateCmdsSubmitted = 0;
+
+  // RendererCmd::UPDATE_RENDERER_TARGET commands
+  uint32_t fboUpdateCount = 0;
+
+  // time spent on the update thread between clearScreen() and
+  // finishFrame()
+  int64_t updateTimeUs = 0;
+
+  // time the update thread spent in finishFrame()
+  int64_t finishFrameTimeUs = 0;
+
+  // time the renderer spent on this frame. It is known only once the frame
+  // is completed, so it is filled in after the frame entered the history.
+  // RendererPolicy::SINGLE_THREADED - the finishFrame() rendering time.
+  // RendererPolicy::MULTI_THREADED  - from the frame hand-off to the render
+  //                                   thread until the render thread
+  //                                   accepted the next frame. Exact when
+  //                                   the render thread is the bottleneck,
+  //                                   an upper bound otherwise.
+  // -1 while not yet known or for dropped RenderQueueMode::MAILBOX frames
+  int64_t renderTimeUs = -1;
+
+  // time spent blocked in DrawMgr::swapBackBuffers()
+  int64_t swapBlockedTimeUs = 0;
+
+  // RenderQueueMode::MAILBOX frames that were overwritten by this frame
+  // before being submitted to the renderer
+  uint32_t droppedFrameCount = 0;
+};
+
+#endif /* MANAGER_UTILS_FRAMESTATS_H_ */
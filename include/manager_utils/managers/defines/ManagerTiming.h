@@ -0,0 +1,31 @@
+#ifndef MANAGER_UTILS_MANAGERTIMING_H_
+#define MANAGER_UTILS_MANAGERTIMING_H_
+
+// System headers
+#include <cstdint>
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+
+/* ::process() timing of a single manager over the timing history window.
+ * All time values are in microseconds.
+ * */
+struct ManagerTiming {
+  const char *name = nullptr;
+
+  int64_t lastUs = 0;
+  int64_t avgUs = 0;
+  int64_t p99Us = 0;
+  int64_t maxUs = 0;
+
+  // processed frames since init
+  uint64_t processedCount = 0;
+
+  // frames, in which the manager exceeded its frame budget slice
+  uint64_t overrunsCount = 0;
+};
+
+#endif /* MANAGER_UTILS_MANAGERTIMING_H_ */
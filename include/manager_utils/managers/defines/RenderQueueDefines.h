@@ -0,0 +1,32 @@
+#ifndef MANAGER_UTILS_RENDERQUEUEDEFINES_H_
+#define MANAGER_UTILS_RENDERQUEUEDEFINES_H_
+
+// System headers
+#include <cstdint>
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+
+enum class RenderQueueMode : uint8_t {
+  /* DrawMgr forwards every call directly to the Renderer.
+   * With RendererPolicy::MULTI_THREADED the update thread blocks in
+   * finishFrame() until the render thread consumes the previous frame.
+   * */
+  DOUBLE_BUFFERED,
+
+  /* DrawMgr records every frame into one of 3 slots. A dedicated submit
+   * thread replays the newest complete frame to the Renderer and absorbs
+   * the back buffer swap stall, so the update thread never blocks on
+   * the render thread. Frames that are overwritten before being
+   * submitted are dropped (only their draw commands - renderer commands
+   * such as Fbo updates are always carried forward).
+   *
+   * NOTE: only applicable for RendererPolicy::MULTI_THREADED
+   * */
+  MAILBOX
+};
+
+#endif /* MANAGER_UTILS_RENDERQUEUEDEFINES_H_ */
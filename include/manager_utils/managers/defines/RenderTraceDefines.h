@@ -0,0 +1,69 @@
+#ifndef MANAGER_UTILS_RENDERTRACEDEFINES_H_
+#define MANAGER_UTILS_RENDERTRACEDEFINES_H_
+
+/* Render trace binary format (native endianness):
+ *
+ * Header:
+ *   char     magic[8]      - RENDER_TRACE_MAGIC
+ *   uint32_t version       - RENDER_TRACE_VERSION
+ *   uint32_t drawParamsSize - sizeof(DrawParams) of the recording build
+ *   int32_t  monitorWidth
+ *   int32_t  monitorHeight
+ *
+ * Followed by records until the end of the file:
+ *   uint8_t  RenderTraceRecordType
+ *   uint8_t  RendererCmd (only meaningful for RENDERER_CMD records)
+ *   uint32_t payload bytes
+ *   uint8_t  payload[payload bytes]
+ *
+ * The textures, that are created/destroyed while recording, are recorded
+ * with their size (TEXTURE_CREATED/TEXTURE_DESTROYED), so the replay can
+ * substitute them with placeholder textures.
+ * */
+
+// System headers
+#include <cstdint>
+
+// Other libraries headers
+#include "sdl_utils/drawing/defines/DrawConstants.h"
+
+// Own components headers
+
+// Forward declarations
+
+constexpr char RENDER_TRACE_MAGIC[8] = { 'M', 'U', 'R', 'T', 'R', 'A', 'C', 'E' };
+constexpr uint32_t RENDER_TRACE_VERSION = 2;
+
+enum class RenderTraceRecordType : uint8_t {
+  FRAME_BEGIN,       // DrawMgr::clearScreen()
+  FRAME_END,         // DrawMgr::finishFrame(), payload: uint8_t override flag
+  DRAW_CMD,          // payload: DrawParams
+  RENDERER_CMD,      // payload: the renderer command data
+  RENDERER_DATA,     // payload: the renderer data
+  LOCK_RENDERER,
+  UNLOCK_RENDERER,
+  MOVE_GLOBAL_X,     // payload: int32_t
+  MOVE_GLOBAL_Y,     // payload: int32_t
+  RESET_GLOBAL_MOVEMENT,
+  TEXTURE_CREATED,   // payload: RenderTraceTexture
+  TEXTURE_DESTROYED, // payload: RenderTraceTexture (without size)
+
+  COUNT
+};
+
+struct RenderTraceTexture {
+  // rsrcId for WidgetType::IMAGE or textId/spriteBufferId for the others
+  uint64_t containerId = 0;
+  int32_t width = 0;
+  int32_t height = 0;
+  WidgetType widgetType = WidgetType::IMAGE;
+};
+
+struct RenderTraceHeader {
+  uint32_t version = 0;
+  uint32_t drawParamsSize = 0;
+  int32_t monitorWidth = 0;
+  int32_t monitorHeight = 0;
+};
+
+#endif /* MANAGER_UTILS_RENDERTRACEDEFINES_H_ */
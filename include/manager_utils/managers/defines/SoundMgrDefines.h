@@ -0,0 +1,61 @@
+#ifndef MANAGER_UTILS_SOUNDMGRDEFINES_H_
+#define MANAGER_UTILS_SOUNDMGRDEFINES_H_
+
+// System headers
+#include <cstdint>
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+
+/* When all voices are busy a new sound steals the oldest voice with the
+ * lowest priority, which is not higher than its own.
+ * If all playing voices have a higher priority - the new sound is dropped.
+ * */
+enum class SoundPriority : uint8_t {
+  LOW,
+  NORMAL,
+  HIGH,
+  CRITICAL,
+
+  COUNT
+};
+
+struct VoicePoolStats {
+  int32_t voicesCount = 0;
+  int32_t busyVoicesCount = 0;
+
+  // voices that were stopped in order to play a new sound
+  uint64_t stolenVoicesCount = 0;
+
+  // sounds that could not be played, because all voices had higher priority
+  uint64_t droppedSoundsCount = 0;
+};
+
+/* Per rsrcId playback limits for sound chunks. 0 means no limit.
+ * */
+struct SoundPlaybackLimits {
+  /* plays of the same chunk, which are requested sooner than this
+   * after its last started play are merged into the already playing voice
+   * */
+  int64_t minRetriggerIntervalMs = 0;
+
+  /* plays of the same chunk, which would exceed this number of
+   * concurrently playing voices are dropped
+   * */
+  int32_t maxInstances = 0;
+};
+
+struct SoundTriggerStats {
+  uint64_t startedPlaysCount = 0;
+
+  // plays within the minimum retrigger interval
+  uint64_t mergedPlaysCount = 0;
+
+  // plays over the maximum instances count
+  uint64_t droppedPlaysCount = 0;
+};
+
+#endif /* MANAGER_UTILS_SOUNDMGRDEFINES_H_ */
@@ -0,0 +1,28 @@
+#ifndef MANAGER_UTILS_STARTUPTIMELINE_H_
+#define MANAGER_UTILS_STARTUPTIMELINE_H_
+
+// System headers
+#include <cstdint>
+#include <vector>
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+
+struct StartupTimelineEvent {
+  // points to a string with static storage duration (manager name)
+  const char *name = nullptr;
+
+  // relative to the start of ManagerHandler::init()
+  int64_t startUs = 0;
+  int64_t durationUs = 0;
+};
+
+struct StartupTimeline {
+  std::vector<StartupTimelineEvent> events;
+  int64_t totalUs = 0;
+};
+
+#endif /* MANAGER_UTILS_STARTUPTIMELINE_H_ */
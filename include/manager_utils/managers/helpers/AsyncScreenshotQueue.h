@@ -0,0 +1,173 @@
+#ifndef MANAGER_UTILS_ASYNCSCREENSHOTQUEUE_H_
+#define MANAGER_UTILS_ASYNCSCREENSHOTQUEUE_H_
+
+/*
+ * AsyncScreenshotQueue.h
+ *
+ *  Brief: Queues screenshot requests, so that:
+ *         - at most one screenshot is issued to the renderer per frame
+ *           (bursts of requests do not stack their cost into one frame);
+ *         - the caller is not blocked and is notified through a callback
+ *           once the renderer is guaranteed to have processed the
+ *           screenshot command.
+ *
+ *         The renderer writes the screenshot into a temporary file next
+ *         to the requested one. The file system work is performed by
+ *         a worker thread:
+ *         - before the request is issued, a stale temporary file is
+ *           removed (so a leftover file is never reported as success);
+ *         - once the request is completed, the temporary file is
+ *           validated and renamed to the requested file.
+ *
+ *         NOTE: the pixel read back, the PNG/JPG encoding and the file
+ *         write are a single render thread command in sdl_utils
+ *         (Renderer::takeScreenshot_UT()). The Renderer exposes no pixel
+ *         read back, so the encoding can not be moved to the worker thread.
+ *
+ *         Completion is tracked with a monotonic "completion marker"
+ *         provided by the DrawMgr. A request is completed once the marker
+ *         reaches the value that was reserved for it when it was issued.
+ */
+
+// System headers
+#include <cstdint>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Other libraries headers
+#include "sdl_utils/drawing/defines/RendererDefines.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+
+class AsyncScreenshotQueue {
+public:
+  /** @param const char *      - file path of the screenshot
+   *  @param const ErrorCode   - SUCCESS if the file was written
+   * */
+  using ScreenshotDoneCb =
+      std::function<void(const char *file, const ErrorCode outcome)>;
+
+  struct Request {
+    std::string file;
+
+    // the file that the renderer writes into
+    std::string tempFile;
+    ScreenshotDoneCb doneCb;
+    uint64_t id = 0;
+    uint64_t completionMarker = 0;
+    int32_t quality = 0;
+    ScreenshotContainer container = ScreenshotContainer();
+  };
+
+  AsyncScreenshotQueue();
+
+  ~AsyncScreenshotQueue() noexcept;
+
+  /** @brief used to start the file system worker thread
+   * */
+  void init();
+
+  /** @brief used to stop and join the file system worker thread.
+   *         Not yet completed requests are discarded - their temporary
+   *         files are removed and their callbacks are invoked with
+   *         ErrorCode::FAILURE. New requests are rejected until ::init()
+   * */
+  void deinit();
+
+  /** @brief used to enqueue a screenshot request
+   *
+   *  @return ErrorCode - FAILURE if too many requests are pending
+   * */
+  ErrorCode addRequest(const char *file, const ScreenshotContainer container,
+                       const int32_t quality, const ScreenshotDoneCb &doneCb);
+
+  /** @brief used to acquire the next request that should be issued
+   *         to the renderer. The request is moved to the in-flight list
+   *
+   *  @param const uint64_t - the marker value after which the renderer
+   *                          is guaranteed to have executed the request
+   *
+   *  @return const Request * - nullptr if there is no request, that is
+   *                            ready to be issued
+   * */
+  const Request *issueNextRequest(const uint64_t completionMarker);
+
+  /** @brief used to hand the completed requests to the worker thread for
+   *         validation and to invoke the callbacks of the validated ones
+   *
+   *  @param const uint64_t - current completion marker
+   * */
+  void dispatchCompleted(const uint64_t currentMarker);
+
+  /** @brief used to check whether a request is ready to be issued
+   *         (its stale temporary file was already removed)
+   * */
+  bool hasPendingRequests() const;
+
+  bool hasInFlightRequests() const {
+    return !_inFlightRequests.empty() || !_validatingRequests.empty();
+  }
+
+private:
+  enum class FileJobType : uint8_t {
+    PREPARE, VALIDATE
+  };
+
+  struct FileJob {
+    std::string file;
+    std::string tempFile;
+    FileJobType type = FileJobType::PREPARE;
+  };
+
+  void workerLoop();
+
+  void pushFileJob(FileJob &&job);
+
+  void executeFileJob(const FileJob &job);
+
+  static void prepare(const FileJob &job);
+
+  static ErrorCode validate(const FileJob &job);
+
+  static void discard(const Request &request);
+
+  // update thread only
+  std::deque<Request> _pendingRequests;
+  std::deque<Request> _inFlightRequests;
+  std::deque<Request> _validatingRequests;
+
+  // reused storage for validated requests, so callbacks are invoked
+  // after the lists are updated (callbacks may add new requests)
+  std::vector<Request> _completedRequests;
+  std::vector<ErrorCode> _completedOutcomes;
+
+  uint64_t _nextRequestId;
+
+  std::thread _worker;
+
+  // guards the members below
+  mutable std::mutex _mutex;
+  std::condition_variable _jobsCondVar;
+  std::deque<FileJob> _fileJobs;
+
+  // outcomes of the VALIDATE jobs in the order of the requests
+  std::vector<ErrorCode> _validatedOutcomes;
+
+  // jobs are executed in order -> the id of the last prepared request
+  uint64_t _lastPreparedId;
+
+  bool _isRunning;
+
+  // update thread only
+  bool _isAcceptingRequests;
+};
+
+#endif /* MANAGER_UTILS_ASYNCSCREENSHOTQUEUE_H_ */
@@ -0,0 +1,112 @@
+#ifndef MANAGER_UTILS_ASYNCTEXTQUEUE_H_
+#define MANAGER_UTILS_ASYNCTEXTQUEUE_H_
+
+/*
+ * AsyncTextQueue.h
+ *
+ *  Brief: Queue of text rasterization requests. The requests are executed
+ *         in FIFO order from ::process() within a time budget, so
+ *         long (localized) strings are spread across frames instead of
+ *         causing a hitch on the requesting call.
+ *
+ *         Every request is identified by a ticket. The result is
+ *         acquired (consumed) with ::poll().
+ */
+
+// System headers
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <string>
+#include <unordered_map>
+
+// Other libraries headers
+#include "utils/drawing/Color.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+
+// 0 is never a valid ticket
+constexpr uint64_t INVALID_ASYNC_TEXT_TICKET = 0;
+
+struct AsyncTextResult {
+  ErrorCode errCode = ErrorCode::FAILURE;
+  int32_t textId = 0;
+  int32_t width = 0;
+  int32_t height = 0;
+};
+
+class AsyncTextQueue {
+public:
+  using LoadTextCb = std::function<ErrorCode(const uint64_t fontId,
+      const char *text, const Color &color, int32_t &outTextId,
+      int32_t &outWidth, int32_t &outHeight)>;
+  using UnloadTextCb = std::function<void(const int32_t textId)>;
+
+  AsyncTextQueue();
+
+  void init(const LoadTextCb &loadTextCb, const UnloadTextCb &unloadTextCb);
+
+  /** @brief used to enqueue a text rasterization
+   *
+   *  @param const uint64_t - unique font ID
+   *  @param const char *   - text content
+   *  @param const Color &  - text color
+   *
+   *  @return uint64_t      - ticket for the request
+   * */
+  uint64_t submit(const uint64_t fontId, const char *text,
+                  const Color &color);
+
+  /** @brief used to acquire the result of a completed request.
+   *         The result is consumed (the caller owns the textId).
+   *
+   *  @param const uint64_t    - request ticket
+   *  @param AsyncTextResult & - the result
+   *
+   *  @return bool - is the request completed
+   * */
+  bool poll(const uint64_t ticket, AsyncTextResult &outResult);
+
+  /** @brief used to drop a request. If it was already completed its
+   *         text is unloaded
+   *
+   *  @param const uint64_t - request ticket
+   * */
+  void cancel(const uint64_t ticket);
+
+  /** @brief used to execute requests for up to budgetUs microseconds.
+   *         At least one request is executed per call (if any).
+   *
+   *  @param const int64_t - time budget in microseconds
+   * */
+  void process(const int64_t budgetUs);
+
+  /** @brief used to drop every request and unload not consumed results
+   * */
+  void clear();
+
+  uint32_t getPendingCount() const {
+    return static_cast<uint32_t>(_pending.size());
+  }
+
+private:
+  struct Request {
+    uint64_t ticket = INVALID_ASYNC_TEXT_TICKET;
+    uint64_t fontId = 0;
+    std::string text;
+    Color color = Colors::BLACK;
+  };
+
+  LoadTextCb _loadTextCb;
+  UnloadTextCb _unloadTextCb;
+
+  std::deque<Request> _pending;
+  std::unordered_map<uint64_t, AsyncTextResult> _completed;
+
+  uint64_t _nextTicket;
+};
+
+#endif /* MANAGER_UTILS_ASYNCTEXTQUEUE_H_ */
@@ -0,0 +1,82 @@
+#ifndef MANAGER_UTILS_FINISHEDCHANNELQUEUE_H_
+#define MANAGER_UTILS_FINISHEDCHANNELQUEUE_H_
+
+/*
+ * FinishedChannelQueue.h
+ *
+ *  Brief: Fixed capacity single producer, single consumer lock-free queue
+ *         for the sound channels, which finished playing.
+ *
+ *         The producer is the SDL audio thread (channel finished callback)
+ *         and the consumer is the thread, which processes the SoundMgr.
+ *         ::push() and ::pop() never block and never allocate. The storage
+ *         is allocated once in ::init().
+ */
+
+// System headers
+#include <cstdint>
+#include <atomic>
+
+// Other libraries headers
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+
+class FinishedChannelQueue {
+public:
+  FinishedChannelQueue();
+
+  ~FinishedChannelQueue() noexcept;
+
+  FinishedChannelQueue(const FinishedChannelQueue &other) = delete;
+  FinishedChannelQueue &operator=(const FinishedChannelQueue &other) = delete;
+
+  /** @brief used to allocate the queue storage
+   *
+   *  @param const uint32_t - requested capacity. Rounded up to a power of 2
+   *
+   *  @return ErrorCode - error code
+   * */
+  ErrorCode init(const uint32_t capacity);
+
+  /** @brief used to release the queue storage.
+   *         NOTE: the producer must no longer ::push() at this point
+   * */
+  void deinit();
+
+  /** @brief used to enqueue a finished channel (producer side)
+   *
+   *  @param const int32_t - finished channel
+   *
+   *  @return bool - false if the queue was full and the channel was dropped
+   * */
+  bool push(const int32_t channel);
+
+  /** @brief used to dequeue a finished channel (consumer side)
+   *
+   *  @param int32_t & - the dequeued channel
+   *
+   *  @return bool - false if the queue is empty
+   * */
+  bool pop(int32_t &outChannel);
+
+  uint64_t getDroppedCount() const {
+    return _droppedCount.load(std::memory_order_relaxed);
+  }
+
+private:
+  int32_t *_channels;
+  uint32_t _mask;
+
+  // written by the producer
+  alignas(64) std::atomic<uint32_t> _head;
+
+  // written by the consumer
+  alignas(64) std::atomic<uint32_t> _tail;
+
+  std::atomic<uint64_t> _droppedCount;
+};
+
+#endif /* MANAGER_UTILS_FINISHEDCHANNELQUEUE_H_ */
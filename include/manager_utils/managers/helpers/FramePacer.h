@@ -0,0 +1,88 @@
+#ifndef MANAGER_UTILS_FRAMEPACER_H_
+#define MANAGER_UTILS_FRAMEPACER_H_
+
+/*
+ * FramePacer.h
+ *
+ *  Brief: Enforces a maximum frame rate for the thread that drives the
+ *         clearScreen()/finishFrame() cycle.
+ *
+ *         Frame deadlines are absolute (start + N * frameTime), so small
+ *         oversleeps do not accumulate into a lower frame rate.
+ *         If a frame misses its deadline by more than a whole frame
+ *         the schedule is re-synchronized instead of trying to catch up
+ *         with a burst of frames.
+ */
+
+// System headers
+#include <cstdint>
+#include <chrono>
+
+// Other libraries headers
+
+// Own components headers
+#include "manager_utils/managers/defines/FramePacingDefines.h"
+
+// Forward declarations
+
+class FramePacer {
+public:
+  FramePacer();
+
+  /** @brief used to set the target frame rate
+   *
+   *  @param const uint32_t - frames per second. 0 means uncapped
+   * */
+  void setTargetFrameRate(const uint32_t fps);
+
+  void setMode(const FramePacingMode mode) {
+    _mode = mode;
+  }
+
+  FramePacingMode getMode() const {
+    return _mode;
+  }
+
+  /** @brief should be called at the start of every frame
+   * */
+  void onFrameStart();
+
+  /** @brief should be called at the end of every frame.
+   *         Blocks the calling thread until the frame deadline is reached
+   * */
+  void onFrameEnd();
+
+  /** @brief used to acquire the frame timing statistics
+   *                                      since the last ::resetStats() call
+   * */
+  FramePacingStats getStats() const;
+
+  void resetStats();
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  void waitUntil(const Clock::time_point deadline);
+
+  void updateStats(const int64_t frameTimeUs);
+
+  Clock::time_point _frameStartTime;
+  Clock::time_point _nextDeadline;
+  Clock::duration _frameDuration;
+
+  /* exponential moving average of the OS oversleep. It is used as
+   * a safety margin for the LOW_LATENCY mode, so that the thread wakes up
+   * before the deadline and spins only for the remaining part
+   * */
+  Clock::duration _oversleepEstimate;
+
+  FramePacingMode _mode;
+  bool _isFrameStarted;
+
+  FramePacingStats _stats;
+
+  // running sum of squared deviations (Welford's algorithm)
+  double _frameTimeM2;
+};
+
+#endif /* MANAGER_UTILS_FRAMEPACER_H_ */
@@ -0,0 +1,126 @@
+#ifndef MANAGER_UTILS_FRAMESTATSCOLLECTOR_H_
+#define MANAGER_UTILS_FRAMESTATSCOLLECTOR_H_
+
+/*
+ * FrameStatsCollector.h
+ *
+ *  Brief: Gathers FrameStats for the current frame and keeps the
+ *         statistics for the last N finished frames in a ring buffer.
+ *         The ring buffer is allocated once on ::init(), so no allocations
+ *         are made while frames are recorded.
+ */
+
+// System headers
+#include <cstdint>
+#include <chrono>
+#include <vector>
+
+// Other libraries headers
+#include "sdl_utils/drawing/defines/RendererDefines.h"
+
+// Own components headers
+#include "manager_utils/managers/defines/FrameStats.h"
+
+// Forward declarations
+
+class FrameStatsCollector {
+public:
+  /** @brief used to allocate the ring buffer
+   *
+   *  @param const uint32_t - number of frames to keep. 0 disables the
+   *                          frame history
+   * */
+  void init(const uint32_t historySize);
+
+  void onFrameStart();
+
+  void onDrawCmd(const uint64_t bytes) {
+    ++_currFrame.drawCmdCount;
+    _currFrame.drawCmdBytes += bytes;
+  }
+
+  void onRendererCmd(const RendererCmd rendererCmd, const uint64_t bytes);
+
+  void onRendererData(const uint64_t bytes) {
+    _currFrame.rendererDataBytes += bytes;
+  }
+
+  void onStateCmds(const uint64_t received, const uint64_t submitted);
+
+  void onSwapBackBuffers(const int64_t blockedTimeUs) {
+    _currFrame.swapBlockedTimeUs += blockedTimeUs;
+  }
+
+  void onDroppedFrames(const uint64_t droppedFrames) {
+    _currFrame.droppedFrameCount += static_cast<uint32_t>(droppedFrames);
+  }
+
+  void onFinishFrameStart();
+
+  /** @brief used when the current frame was rendered by finishFrame()
+   *         itself (RendererPolicy::SINGLE_THREADED)
+   * */
+  void onFrameRendered() {
+    _currFrame.renderTimeUs = elapsedUs(_finishFrameStartTime, Clock::now());
+  }
+
+  /** @brief used when the current frame was handed off to the render
+   *         thread (RendererPolicy::MULTI_THREADED). This completes
+   *         the previously handed off frame
+   * */
+  void onFrameHandedOff();
+
+  /** @brief used to store the render time of an already finished frame
+   *
+   *  @param const uint64_t - FrameStats::frameId of the frame
+   *  @param const int64_t  - the render time in microseconds
+   * */
+  void onRenderTime(const uint64_t frameId, const int64_t renderTimeUs);
+
+  uint64_t getCurrFrameId() const {
+    return _currFrame.frameId;
+  }
+
+  /** @brief used to finalize the current frame and store it in the history
+   * */
+  void onFinishFrameEnd();
+
+  /** @brief used to acquire the statistics of the last finished frame
+   * */
+  const FrameStats &getLastFrameStats() const;
+
+  /** @brief used to acquire the stored frame history
+   *
+   *  @param std::vector<FrameStats> & - the history ordered from
+   *                                     the oldest to the newest frame
+   * */
+  void getHistory(std::vector<FrameStats> &outHistory) const;
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  static int64_t elapsedUs(const Clock::time_point from,
+                           const Clock::time_point to) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(
+        to - from).count();
+  }
+
+  FrameStats _currFrame;
+  FrameStats _lastFrame;
+
+  std::vector<FrameStats> _history;
+  uint32_t _historyHead = 0;
+  uint32_t _historyCount = 0;
+
+  uint64_t _nextFrameId = 0;
+
+  // the last frame handed off to the render thread
+  uint64_t _handedOffFrameId = 0;
+  bool _hasHandedOffFrame = false;
+  Clock::time_point _handOffTime;
+
+  Clock::time_point _frameStartTime;
+  Clock::time_point _finishFrameStartTime;
+};
+
+#endif /* MANAGER_UTILS_FRAMESTATSCOLLECTOR_H_ */
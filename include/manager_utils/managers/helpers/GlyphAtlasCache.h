@@ -0,0 +1,66 @@
+#ifndef MANAGER_UTILS_GLYPHATLASCACHE_H_
+#define MANAGER_UTILS_GLYPHATLASCACHE_H_
+
+/*
+ * GlyphAtlasCache.h
+ *
+ *  Brief: Reference counted storage of the GlyphAtlases, keyed by
+ *         (fontId, color). An atlas is built on the first acquire and
+ *         destroyed on the last release.
+ */
+
+// System headers
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+// Other libraries headers
+#include "utils/drawing/Color.h"
+
+// Own components headers
+
+// Forward declarations
+class GlyphAtlas;
+
+class GlyphAtlasCache {
+public:
+  GlyphAtlasCache();
+
+  ~GlyphAtlasCache() noexcept;
+
+  /** @brief used to acquire an atlas. The atlas is built if needed
+   *
+   *  @param const uint64_t - unique font ID
+   *  @param const Color &  - glyphs color
+   *
+   *  @return GlyphAtlas * - the atlas (nullptr on failure)
+   * */
+  GlyphAtlas *acquire(const uint64_t fontId, const Color &color);
+
+  /** @brief used to release an atlas, acquired with ::acquire()
+   *
+   *  @param const GlyphAtlas * - the atlas
+   * */
+  void release(const GlyphAtlas *atlas);
+
+  void process();
+
+  /** @brief used to destroy every atlas (regardless of the references)
+   * */
+  void deinit();
+
+  uint32_t getAtlasesCount() const {
+    return static_cast<uint32_t>(_entries.size());
+  }
+
+private:
+  struct Entry {
+    std::unique_ptr<GlyphAtlas> atlas;
+    uint32_t refCount = 0;
+  };
+
+  // the number of font/color combinations is small -> linear search
+  std::vector<Entry> _entries;
+};
+
+#endif /* MANAGER_UTILS_GLYPHATLASCACHE_H_ */
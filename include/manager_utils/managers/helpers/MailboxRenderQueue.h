@@ -0,0 +1,281 @@
+#ifndef MANAGER_UTILS_MAILBOXRENDERQUEUE_H_
+#define MANAGER_UTILS_MAILBOXRENDERQUEUE_H_
+
+/*
+ * MailboxRenderQueue.h
+ *
+ *  Brief: Triple buffered (mailbox) recording of the update thread frames.
+ *
+ *         - the update thread records into the "write" slot and publishes
+ *           it into the "ready" slot on ::finishFrame(). It never waits
+ *           for the render thread.
+ *         - the submit thread takes the "ready" slot as its "read" slot
+ *           and replays it into the Renderer (incl. the potentially
+ *           blocking Renderer::finishFrame_UT() call).
+ *         - if a new frame is published while the "ready" slot was not
+ *           yet consumed, the older frame is dropped. Its non-draw
+ *           operations (renderer commands/data, renderer lock state,
+ *           global movement, screenshots, resource operations) are
+ *           carried in front of the new frame, so resource and Fbo
+ *           state stays consistent.
+ *         - a ready frame that renders outside of the default back
+ *           buffer (renderer unlocked for a Fbo, a changed renderer
+ *           target or a lock-check overriding finish) is never dropped.
+ *           The new frame is queued behind it and both are submitted
+ *           together.
+ *
+ *         Operations that destroy or stream in textures are recorded as
+ *         resource operations (::addResourceOp()). They are executed by
+ *         the submit thread in frame order, so a texture is never
+ *         destroyed before the already published frames, that could
+ *         still draw it, are submitted.
+ *
+ *         Every other direct Renderer *_UT() call outside of this queue
+ *         (for example the SDLContainers text/Fbo creation functions)
+ *         must be performed while holding ::acquireRendererLock().
+ *         The submit thread holds the same lock only while it writes
+ *         the recorded operations into the Renderer - never across the
+ *         blocking Renderer::finishFrame_UT() call.
+ */
+
+// System headers
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Other libraries headers
+#include "sdl_utils/drawing/defines/RendererDefines.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+class Renderer;
+struct DrawParams;
+
+class MailboxRenderQueue {
+public:
+  using ResourceOp = std::function<void()>;
+
+  struct FrameRenderTime {
+    uint64_t frameId = 0;
+    int64_t renderTimeUs = 0;
+  };
+
+  MailboxRenderQueue();
+
+  ~MailboxRenderQueue() noexcept;
+
+  /** @brief used to start the submit thread
+   *
+   *  @param Renderer * - renderer that will receive the recorded frames
+   *
+   *  @return ErrorCode - error code
+   * */
+  ErrorCode init(Renderer *renderer);
+
+  /** @brief used to stop and join the submit thread.
+   *         The draw operations of the frames that are not yet submitted
+   *         are discarded. Their resource operations are still executed,
+   *         so the resource bookkeeping stays consistent
+   * */
+  void deinit();
+
+  //================ START update thread recording functions =============
+
+  void clearScreen();
+
+  /** @brief used to publish the recorded frame to the submit thread
+   *
+   *  @param const bool     - the Renderer::finishFrame_UT() argument
+   *  @param const uint64_t - FrameStats::frameId of the frame, reported
+   *                          back through ::takeRenderTimes()
+   * */
+  void finishFrame(const bool overrideRendererLockCheck,
+                   const uint64_t frameId);
+
+  void addDrawCmd(const DrawParams &drawParams);
+
+  void addRendererCmd(const RendererCmd rendererCmd, const uint8_t *data,
+                      const uint64_t bytes);
+
+  void addRendererData(const uint8_t *data, const uint64_t bytes);
+
+  void lockRenderer();
+
+  void unlockRenderer();
+
+  void moveGlobalX(const int32_t x);
+
+  void moveGlobalY(const int32_t y);
+
+  void resetAbsoluteGlobalMovement();
+
+  void takeScreenshot(const char *file, const ScreenshotContainer container,
+                      const int32_t quality);
+
+  /** @brief used to record an operation, that changes the renderer
+   *         resources (e.g. texture destroy), in the frame stream.
+   *         It is invoked on the submit thread while holding the renderer
+   *         lock, after the previously recorded operations
+   *
+   *  @param const ResourceOp & - the operation
+   * */
+  void addResourceOp(const ResourceOp &op);
+
+  //================= END update thread recording functions ==============
+
+  /** @brief used to acquire exclusive access to the Renderer update
+   *         thread API. The submit thread never holds it for longer
+   *         than the writing of the recorded operations, so the caller
+   *         does not wait for the render thread
+   *
+   *  @return std::unique_lock<std::mutex> - the held lock
+   * */
+  std::unique_lock<std::mutex> acquireRendererLock();
+
+  /** @brief used to acquire the total number of dropped frames
+   * */
+  uint64_t getDroppedFramesCount() const {
+    return _droppedFramesCount.load(std::memory_order_relaxed);
+  }
+
+  /** @brief used to acquire the total number of frames submitted
+   *                                                      to the renderer
+   * */
+  uint64_t getSubmittedFramesCount() const {
+    return _submittedFramesCount.load(std::memory_order_relaxed);
+  }
+
+  /** @brief used to acquire the render times of the frames that the
+   *         render thread completed since the last call.
+   *         The time of a frame spans from its hand-off to the render
+   *         thread until the render thread accepted the next submission.
+   *         Dropped frames are never reported
+   *
+   *  @param std::vector<FrameRenderTime> & - the completed frames. Its
+   *                                          storage is reused internally
+   * */
+  void takeRenderTimes(std::vector<FrameRenderTime> &outRenderTimes);
+
+  /** @brief used to acquire the total number of recorded screenshots
+   *         (update thread only)
+   * */
+  uint64_t getRecordedScreenshotsCount() const {
+    return _recordedScreenshotsCount;
+  }
+
+  /** @brief used to acquire the number of recorded screenshots, that the
+   *         render thread is guaranteed to have executed
+   *         (update thread only)
+   * */
+  uint64_t getCompletedScreenshotsCount();
+
+private:
+  enum class OpType : uint8_t {
+    CLEAR_SCREEN,
+    FINISH_FRAME,
+    DRAW,
+    RENDERER_CMD,
+    RENDERER_DATA,
+    LOCK_RENDERER,
+    UNLOCK_RENDERER,
+    MOVE_GLOBAL_X,
+    MOVE_GLOBAL_Y,
+    RESET_GLOBAL_MOVEMENT,
+    SCREENSHOT,
+    RESOURCE_OP
+  };
+
+  struct RecordedOp {
+    uint64_t dataOffset = 0;
+    uint64_t dataBytes = 0;
+    int32_t param = 0;
+    OpType type = OpType::DRAW;
+    RendererCmd rendererCmd = RendererCmd();
+  };
+
+  struct RecordedFrame {
+    void clear() {
+      ops.clear();
+      payload.clear();
+      resourceOps.clear();
+    }
+
+    std::vector<RecordedOp> ops;
+    std::vector<uint8_t> payload;
+
+    // indexed by RecordedOp::param of the OpType::RESOURCE_OP operations
+    std::vector<ResourceOp> resourceOps;
+  };
+
+  enum SlotIndexes {
+    WRITE_SLOT, READY_SLOT, READ_SLOT, SLOTS_COUNT
+  };
+
+  void submitThreadLoop();
+
+  void recordOp(const OpType type, const int32_t param = 0,
+                const uint8_t *data = nullptr, const uint64_t bytes = 0,
+                const RendererCmd rendererCmd = RendererCmd());
+
+  void replay(const RecordedFrame &frame);
+
+  void onFrameHandedOff(const uint64_t frameId);
+
+  static void executeResourceOps(const RecordedFrame &frame);
+
+  static bool rendersOutsideBackBuffer(const RecordedFrame &frame);
+
+  static void stripDrawOps(RecordedFrame &frame);
+
+  static void appendFrame(const RecordedFrame &from, RecordedFrame &to);
+
+  RecordedFrame _frames[SLOTS_COUNT];
+
+  // index in _frames for the WRITE_SLOT, READY_SLOT and READ_SLOT roles
+  int32_t _slots[SLOTS_COUNT];
+
+  Renderer *_renderer;
+
+  std::thread _submitThread;
+
+  // guards _slots, _hasReadyFrame and _isRunning. Held only for
+  // a couple of instructions (or a frame merge on a drop)
+  std::mutex _mailboxMutex;
+  std::condition_variable _readyCondVar;
+
+  // serializes the Renderer update thread API (and the SDLContainers
+  // state changed by the resource operations)
+  std::mutex _rendererMutex;
+
+  bool _hasReadyFrame;
+  bool _isRunning;
+
+  std::atomic<uint64_t> _droppedFramesCount;
+  std::atomic<uint64_t> _submittedFramesCount;
+
+  // the submission, that contains the last replayed screenshot
+  std::atomic<uint64_t> _lastScreenshotSubmission;
+  std::atomic<uint64_t> _replayedScreenshotsCount;
+
+  // guards _renderTimes
+  std::mutex _renderTimesMutex;
+  std::vector<FrameRenderTime> _renderTimes;
+
+  // submit thread only
+  std::chrono::steady_clock::time_point _handOffTime;
+  uint64_t _handedOffFrameId;
+  bool _hasHandedOffFrame;
+
+  // update thread only
+  uint64_t _recordedScreenshotsCount;
+  uint64_t _completedScreenshotsCount;
+};
+
+#endif /* MANAGER_UTILS_MAILBOXRENDERQUEUE_H_ */
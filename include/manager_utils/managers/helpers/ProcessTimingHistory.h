@@ -0,0 +1,61 @@
+#ifndef MANAGER_UTILS_PROCESSTIMINGHISTORY_H_
+#define MANAGER_UTILS_PROCESSTIMINGHISTORY_H_
+
+/*
+ * ProcessTimingHistory.h
+ *
+ *  Brief: Rolling window of ::process() durations for a single manager.
+ *         Adding a sample is O(1) and never allocates. The percentile is
+ *         computed on demand.
+ */
+
+// System headers
+#include <cstdint>
+#include <vector>
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+
+class ProcessTimingHistory {
+public:
+  ProcessTimingHistory();
+
+  /** @brief used to allocate the window
+   *
+   *  @param const uint32_t - number of the most recent samples kept
+   * */
+  void init(const uint32_t capacity);
+
+  void addSample(const int64_t durationUs);
+
+  int64_t getLastUs() const {
+    return _lastUs;
+  }
+
+  /** @return int64_t - average of the samples in the window
+   * */
+  int64_t getAverageUs() const;
+
+  /** @return int64_t - the requested percentile of the samples in the window
+   * */
+  int64_t getPercentileUs(const uint32_t percentile) const;
+
+  int64_t getMaxUs() const;
+
+  uint64_t getTotalSamplesCount() const {
+    return _totalSamplesCount;
+  }
+
+private:
+  std::vector<int64_t> _samples;
+  uint32_t _nextIdx;
+  uint32_t _samplesCount;
+  int64_t _windowSumUs;
+  int64_t _lastUs;
+  uint64_t _totalSamplesCount;
+};
+
+#endif /* MANAGER_UTILS_PROCESSTIMINGHISTORY_H_ */
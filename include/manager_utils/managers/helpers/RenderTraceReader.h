@@ -0,0 +1,65 @@
+#ifndef MANAGER_UTILS_RENDERTRACEREADER_H_
+#define MANAGER_UTILS_RENDERTRACEREADER_H_
+
+/*
+ * RenderTraceReader.h
+ *
+ *  Brief: Sequential reader for the files produced by RenderTraceRecorder
+ */
+
+// System headers
+#include <cstdint>
+#include <cstdio>
+#include <vector>
+
+// Other libraries headers
+#include "sdl_utils/drawing/defines/RendererDefines.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+#include "manager_utils/managers/defines/RenderTraceDefines.h"
+
+// Forward declarations
+
+struct RenderTraceRecord {
+  RenderTraceRecordType type = RenderTraceRecordType::COUNT;
+  RendererCmd rendererCmd = RendererCmd();
+
+  // reused between the ::readNext() calls
+  std::vector<uint8_t> payload;
+};
+
+class RenderTraceReader {
+public:
+  RenderTraceReader();
+
+  ~RenderTraceReader() noexcept;
+
+  /** @brief used to open the trace file and validate its header
+   *
+   *  @param const char * - file path
+   *
+   *  @return ErrorCode - error code
+   * */
+  ErrorCode open(const char *file);
+
+  void close();
+
+  const RenderTraceHeader &getHeader() const {
+    return _header;
+  }
+
+  /** @brief used to read the next record
+   *
+   *  @param RenderTraceRecord & - the populated record
+   *
+   *  @return bool - false on end of file or on a corrupted record
+   * */
+  bool readNext(RenderTraceRecord &outRecord);
+
+private:
+  FILE *_file;
+  RenderTraceHeader _header;
+};
+
+#endif /* MANAGER_UTILS_RENDERTRACEREADER_H_ */
@@ -0,0 +1,93 @@
+#ifndef MANAGER_UTILS_RENDERTRACERECORDER_H_
+#define MANAGER_UTILS_RENDERTRACERECORDER_H_
+
+/*
+ * RenderTraceRecorder.h
+ *
+ *  Brief: Serializes the DrawMgr command stream (draw commands, renderer
+ *         commands/data and frame boundaries) into a binary trace file.
+ *         For the format check RenderTraceDefines.h
+ *
+ *         The file is written through a large stdio buffer, so recording
+ *         costs roughly a memcpy per command.
+ */
+
+// System headers
+#include <cstdint>
+#include <cstdio>
+
+// Other libraries headers
+#include "sdl_utils/drawing/defines/RendererDefines.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+#include "manager_utils/managers/defines/RenderTraceDefines.h"
+
+// Forward declarations
+struct DrawParams;
+
+class RenderTraceRecorder {
+public:
+  RenderTraceRecorder();
+
+  ~RenderTraceRecorder() noexcept;
+
+  /** @brief used to open the trace file and write its header
+   *
+   *  @param const char *   - file path
+   *  @param const int32_t  - monitor width
+   *  @param const int32_t  - monitor height
+   *
+   *  @return ErrorCode - error code
+   * */
+  ErrorCode start(const char *file, const int32_t monitorWidth,
+                  const int32_t monitorHeight);
+
+  /** @brief used to flush and close the trace file
+   * */
+  void stop();
+
+  bool isRecording() const {
+    return nullptr != _file;
+  }
+
+  void recordFrameBegin() {
+    record(RenderTraceRecordType::FRAME_BEGIN);
+  }
+
+  void recordFrameEnd(const bool overrideRendererLockCheck);
+
+  void recordDrawCmd(const DrawParams &drawParams);
+
+  void recordRendererCmd(const RendererCmd rendererCmd, const uint8_t *data,
+                         const uint64_t bytes) {
+    record(RenderTraceRecordType::RENDERER_CMD, data, bytes, rendererCmd);
+  }
+
+  void recordRendererData(const uint8_t *data, const uint64_t bytes) {
+    record(RenderTraceRecordType::RENDERER_DATA, data, bytes);
+  }
+
+  void recordOp(const RenderTraceRecordType type) {
+    record(type);
+  }
+
+  void recordOp(const RenderTraceRecordType type, const int32_t param);
+
+  /** @param const RenderTraceRecordType - TEXTURE_CREATED or
+   *                                       TEXTURE_DESTROYED
+   *  @param const RenderTraceTexture &  - the texture
+   * */
+  void recordTexture(const RenderTraceRecordType type,
+                     const RenderTraceTexture &texture);
+
+private:
+  void record(const RenderTraceRecordType type, const uint8_t *data = nullptr,
+              const uint64_t bytes = 0,
+              const RendererCmd rendererCmd = RendererCmd());
+
+  FILE *_file;
+  char *_fileBuffer;
+};
+
+#endif /* MANAGER_UTILS_RENDERTRACERECORDER_H_ */
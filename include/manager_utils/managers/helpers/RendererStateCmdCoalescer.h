@@ -0,0 +1,160 @@
+#ifndef MANAGER_UTILS_RENDERERSTATECMDCOALESCER_H_
+#define MANAGER_UTILS_RENDERERSTATECMDCOALESCER_H_
+
+/*
+ * RendererStateCmdCoalescer.h
+ *
+ *  Brief: Collects the per-texture state changing renderer commands
+ *         (RendererCmd::CHANGE_TEXTURE_BLENDMODE and
+ *          RendererCmd::CHANGE_TEXTURE_OPACITY) for the current frame.
+ *
+ *         Only the last requested value per texture is kept. Values that
+ *         are equal to the last one submitted to the renderer are dropped.
+ *
+ *         NOTE: the renderer applies texture state commands before it
+ *               draws the widgets of the frame (on RendererCmd::FINISH_FRAME)
+ *               so keeping only the last value for a frame does not alter
+ *               the drawn result.
+ *               Commands that draw immediately (for example an Fbo update)
+ *               act as a barrier - ::flush() must be called before them.
+ */
+
+// System headers
+#include <cstdint>
+#include <functional>
+#include <unordered_map>
+#include <vector>
+
+// Other libraries headers
+#include "sdl_utils/drawing/defines/RendererDefines.h"
+#include "sdl_utils/drawing/defines/DrawConstants.h"
+#include "sdl_utils/drawing/DrawParams.h"
+
+// Own components headers
+
+// Forward declarations
+
+class RendererStateCmdCoalescer {
+public:
+  using SubmitCmdCb = std::function<void(const RendererCmd rendererCmd,
+                                         const uint8_t *data,
+                                         const uint64_t bytes)>;
+
+  /** @brief used to store a blend mode change request for a texture
+   *
+   *  @param const WidgetType - IMAGE, TEXT or SPRITE_BUFFER
+   *  @param const uint64_t   - rsrcId for WidgetType::IMAGE or
+   *                            textId/spriteBufferId for the others
+   *  @param const BlendMode  - requested blend mode
+   * */
+  void addBlendModeCmd(const WidgetType widgetType, const uint64_t containerId,
+                       const BlendMode blendMode);
+
+  /** @brief used to store an opacity change request for a texture
+   *
+   *  @param const WidgetType - TEXT or SPRITE_BUFFER
+   *  @param const uint64_t   - textId/spriteBufferId
+   *  @param const int32_t    - requested opacity
+   * */
+  void addOpacityCmd(const WidgetType widgetType, const uint64_t containerId,
+                     const int32_t opacity);
+
+  /** @brief used to submit the pending commands to the renderer in the
+   *         order in which their textures were first touched this frame
+   *
+   *  @param const SubmitCmdCb & - receiver of the commands
+   * */
+  void flush(const SubmitCmdCb &submitCb);
+
+  /** @brief used to forget the state that was submitted to the renderer
+   *         for a texture, that was re-created (for example text reload).
+   *         Pending commands are kept - they will be applied over the
+   *         re-created texture.
+   *
+   *  @param const WidgetType - IMAGE, TEXT or SPRITE_BUFFER
+   *  @param const uint64_t   - rsrcId/textId/spriteBufferId
+   * */
+  void onTextureRecreated(const WidgetType widgetType,
+                          const uint64_t containerId);
+
+  /** @brief used to forget everything known about a destroyed texture.
+   *         Pending commands are discarded, because the containerId
+   *         could be reused by a new texture.
+   *
+   *  @param const WidgetType - IMAGE, TEXT or SPRITE_BUFFER
+   *  @param const uint64_t   - rsrcId/textId/spriteBufferId
+   * */
+  void onTextureDestroyed(const WidgetType widgetType,
+                          const uint64_t containerId);
+
+  /** @brief used to forget the whole state that was submitted to the
+   *         renderer (for example on renderer re-creation)
+   * */
+  void invalidateAll();
+
+  /** @brief used to acquire the number of commands that were received
+   *         since the last ::resetCounters() call
+   * */
+  uint64_t getReceivedCmdsCount() const {
+    return _receivedCmdsCount;
+  }
+
+  /** @brief used to acquire the number of commands that were actually
+   *         submitted to the renderer since the last ::resetCounters() call
+   * */
+  uint64_t getSubmittedCmdsCount() const {
+    return _submittedCmdsCount;
+  }
+
+  void resetCounters();
+
+private:
+  enum class StateType : uint8_t {
+    BLEND_MODE, OPACITY
+  };
+
+  struct StateKey {
+    bool operator==(const StateKey &other) const {
+      return (containerId == other.containerId) &&
+             (widgetType == other.widgetType) && (stateType == other.stateType);
+    }
+
+    uint64_t containerId = 0;
+    WidgetType widgetType = WidgetType::IMAGE;
+    StateType stateType = StateType::OPACITY;
+  };
+
+  struct StateKeyHash {
+    size_t operator()(const StateKey &key) const;
+  };
+
+  struct PendingCmd {
+    StateKey key;
+    int32_t value = 0;
+
+    // set when the texture is destroyed mid frame. The entry stays in
+    // place (so removal is O(1)) and is skipped on ::flush()
+    bool isDiscarded = false;
+  };
+
+  void addCmd(const StateKey &key, const int32_t value);
+
+  void removePendingCmd(const StateKey &key);
+
+  void submitCmd(const SubmitCmdCb &submitCb, const PendingCmd &cmd) const;
+
+  // pending commands for the current frame in first touched order
+  std::vector<PendingCmd> _pendingCmds;
+
+  // (widgetType, containerId, stateType) -> index in _pendingCmds
+  // discarded entries are not present
+  std::unordered_map<StateKey, size_t, StateKeyHash> _pendingIndexes;
+
+  // last value per key that was actually sent to the renderer
+  std::unordered_map<StateKey, int32_t, StateKeyHash> _committedState;
+
+  uint64_t _receivedCmdsCount = 0;
+  uint64_t _submittedCmdsCount = 0;
+};
+
+#endif /* MANAGER_UTILS_RENDERERSTATECMDCOALESCER_H_ */
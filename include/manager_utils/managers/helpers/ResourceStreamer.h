@@ -0,0 +1,184 @@
+#ifndef MANAGER_UTILS_RESOURCESTREAMER_H_
+#define MANAGER_UTILS_RESOURCESTREAMER_H_
+
+/*
+ * ResourceStreamer.h
+ *
+ *  Brief: Prioritized asynchronous loading of on-demand resources.
+ *
+ *         Requests are grouped into RendererCmd::LOAD_TEXTURE_MULTIPLE
+ *         batches from ::process(). The decoding is executed by the
+ *         SDLContainers worker threads and the GPU upload by the drawing
+ *         thread, so the requesting (update) thread never blocks on disk
+ *         I/O or decode.
+ *
+ *         The order of dispatch is:
+ *           - requests with an expired deadline
+ *           - higher priority
+ *           - earlier deadline
+ *           - submission order
+ *
+ *         Every ::process() dispatches requests up to an upload budget
+ *         (in texture bytes), which limits the upload work that the
+ *         drawing thread receives per frame. Requests with an expired
+ *         deadline are dispatched regardless of the budget.
+ *
+ *         Every request is identified by a ticket. The state is acquired
+ *         with ::poll(). Once READY is returned the caller owns a
+ *         reference to the resource (unloadResourceOnDemandSingle()).
+ */
+
+// System headers
+#include <cstdint>
+#include <chrono>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+
+// 0 is never a valid ticket
+constexpr uint64_t INVALID_STREAM_TICKET = 0;
+
+// 0 means no deadline
+constexpr int64_t NO_STREAM_DEADLINE = 0;
+
+enum class StreamRequestState : uint8_t {
+  PENDING,
+  READY,
+  FAILED
+};
+
+class ResourceStreamer {
+public:
+  using LoadBatchCb = std::function<void(const std::vector<uint64_t> &rsrcIds,
+                                         const int32_t batchId)>;
+  using UnloadRsrcCb = std::function<void(const uint64_t rsrcId)>;
+
+  ResourceStreamer();
+
+  void init(const LoadBatchCb &loadBatchCb, const UnloadRsrcCb &unloadRsrcCb);
+
+  /** @brief used to enqueue a resource load
+   *
+   *  @param const uint64_t - unique resource ID
+   *  @param const int32_t  - priority (higher is dispatched first)
+   *  @param const int64_t  - deadline in milliseconds from now
+   *                          (NO_STREAM_DEADLINE for none)
+   *  @param const uint64_t - texture size in bytes (used for the budget)
+   *
+   *  @return uint64_t      - ticket for the request
+   * */
+  uint64_t submit(const uint64_t rsrcId, const int32_t priority,
+                  const int64_t deadlineMs, const uint64_t textureBytes);
+
+  /** @brief used to enqueue a request that is already known to be failed.
+   *         ::poll() reports it as FAILED.
+   * */
+  uint64_t submitFailed();
+
+  /** @brief used to acquire the state of a request.
+   *         READY and FAILED results are consumed.
+   *
+   *  @param const uint64_t - request ticket
+   *
+   *  @return StreamRequestState - state of the request
+   * */
+  StreamRequestState poll(const uint64_t ticket);
+
+  /** @brief used to drop a request. If it was already loaded the
+   *         resource is unloaded (immediately or on batch completion)
+   *
+   *  @param const uint64_t - request ticket
+   * */
+  void cancel(const uint64_t ticket);
+
+  /** @brief used to check whether a batch is owned by the streamer
+   * */
+  static bool isStreamingBatch(const int32_t batchId);
+
+  /** @brief a callback for a completed RendererCmd::LOAD_TEXTURE_MULTIPLE
+   *         batch. Could be called from any thread.
+   *
+   *  @param const int32_t - unique ID of the batch
+   * */
+  void onBatchCompleted(const int32_t batchId);
+
+  /** @brief used to apply the completed batches and to dispatch the next
+   *         batch within the upload budget.
+   *         At least one request is dispatched per call (if any).
+   *
+   *  @param const uint64_t - upload budget in texture bytes
+   * */
+  void process(const uint64_t uploadBudgetBytes);
+
+  /** @brief used to drop every request.
+   *         NOTE: resources are not unloaded. Intended for deinit, where
+   *               the containers release everything.
+   * */
+  void clear();
+
+  uint32_t getQueuedCount() const {
+    return static_cast<uint32_t>(_queued.size());
+  }
+
+  uint32_t getInFlightCount() const {
+    return _inFlightCount;
+  }
+
+private:
+  using Clock = std::chrono::steady_clock;
+
+  enum class EntryState : uint8_t {
+    QUEUED,
+    IN_FLIGHT,
+    CANCELLED_IN_FLIGHT,
+    READY,
+    FAILED
+  };
+
+  struct Entry {
+    Clock::time_point deadline;
+    uint64_t rsrcId = 0;
+    uint64_t textureBytes = 0;
+    int32_t priority = 0;
+    bool hasDeadline = false;
+    EntryState state = EntryState::QUEUED;
+  };
+
+  void applyCompletedBatches();
+
+  void dispatchBatch(const uint64_t uploadBudgetBytes);
+
+  void sortQueued(const Clock::time_point now);
+
+  LoadBatchCb _loadBatchCb;
+  UnloadRsrcCb _unloadRsrcCb;
+
+  std::unordered_map<uint64_t, Entry> _entries;
+
+  // tickets of the QUEUED entries
+  std::vector<uint64_t> _queued;
+
+  // batchId -> tickets
+  std::unordered_map<int32_t, std::vector<uint64_t>> _batches;
+
+  // reused between the ::process() calls
+  std::vector<uint64_t> _batchRsrcIds;
+  std::vector<int32_t> _completedBatchesCopy;
+
+  // written from the drawing thread
+  std::mutex _completedMutex;
+  std::vector<int32_t> _completedBatches;
+
+  uint64_t _nextTicket;
+  int32_t _nextBatchId;
+  uint32_t _inFlightCount;
+};
+
+#endif /* MANAGER_UTILS_RESOURCESTREAMER_H_ */
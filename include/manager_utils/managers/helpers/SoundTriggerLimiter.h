@@ -0,0 +1,102 @@
+#ifndef MANAGER_UTILS_SOUNDTRIGGERLIMITER_H_
+#define MANAGER_UTILS_SOUNDTRIGGERLIMITER_H_
+
+/*
+ * SoundTriggerLimiter.h
+ *
+ *  Brief: Rate limits and coalesces rapid repeated plays of the same
+ *         sound chunk (for example many buttons or rolling counters
+ *         triggering the same Sound in a single frame).
+ *
+ *         A play, requested within the minimum retrigger interval of the
+ *         last started play of the chunk, is merged into that voice.
+ *         A play, which would exceed the maximum concurrent instances of
+ *         the chunk, is dropped.
+ *         Per rsrcId limits override the default ones.
+ */
+
+// System headers
+#include <cstdint>
+#include <unordered_map>
+
+// Other libraries headers
+
+// Own components headers
+#include "manager_utils/managers/defines/SoundMgrDefines.h"
+
+// Forward declarations
+
+enum class SoundTriggerDecision : uint8_t {
+  PLAY,
+  MERGE,
+  DROP
+};
+
+class SoundTriggerLimiter {
+public:
+  void setDefaultLimits(const SoundPlaybackLimits &limits) {
+    _defaultLimits = limits;
+  }
+
+  /** @brief used to override the default limits for a chunk
+   *
+   *  @param const uint64_t              - unique resource ID
+   *  @param const SoundPlaybackLimits & - limits for the chunk
+   * */
+  void setLimits(const uint64_t rsrcId, const SoundPlaybackLimits &limits);
+
+  /** @brief used to restore the default limits for a chunk
+   *
+   *  @param const uint64_t - unique resource ID
+   * */
+  void resetLimits(const uint64_t rsrcId);
+
+  /** @brief used to decide whether a play request for a chunk should
+   *         be started. PLAY decisions are recorded as started plays.
+   *
+   *  @param const uint64_t - unique resource ID
+   *  @param const int32_t  - currently playing instances of the chunk
+   *  @param const int64_t  - current time in milliseconds
+   *
+   *  @return SoundTriggerDecision - the decision
+   * */
+  SoundTriggerDecision onPlayRequested(const uint64_t rsrcId,
+                                       const int32_t activeInstancesCount,
+                                       const int64_t nowMs);
+
+  /** @brief used to undo the last PLAY decision for a chunk, if the
+   *         play could not be started after all
+   *
+   *  @param const uint64_t - unique resource ID
+   * */
+  void onPlayFailed(const uint64_t rsrcId);
+
+  /** @return SoundTriggerStats - the stats for the chunk
+   * */
+  SoundTriggerStats getStats(const uint64_t rsrcId) const;
+
+  /** @return const SoundTriggerStats & - the stats for all chunks
+   * */
+  const SoundTriggerStats &getTotalStats() const {
+    return _totalStats;
+  }
+
+  void clear();
+
+private:
+  static constexpr int64_t NO_PLAY_STARTED = INT64_MIN;
+
+  struct ChunkTriggerData {
+    SoundPlaybackLimits limits;
+    SoundTriggerStats stats;
+    int64_t lastStartMs = NO_PLAY_STARTED;
+    int64_t prevStartMs = NO_PLAY_STARTED;
+    bool hasCustomLimits = false;
+  };
+
+  SoundPlaybackLimits _defaultLimits;
+  SoundTriggerStats _totalStats;
+  std::unordered_map<uint64_t, ChunkTriggerData> _chunks;
+};
+
+#endif /* MANAGER_UTILS_SOUNDTRIGGERLIMITER_H_ */
@@ -0,0 +1,117 @@
+#ifndef MANAGER_UTILS_STARTUPPROFILER_H_
+#define MANAGER_UTILS_STARTUPPROFILER_H_
+
+/*
+ * StartupProfiler.h
+ *
+ *  Brief: Summary of the application startup.
+ *
+ *         Records the load time of every individual asset, so the total
+ *         startup time and the top-N slowest assets could be logged.
+ *
+ *         The zones themselves (window creation, renderer init,
+ *         containers load, managers init, etc.) are recorded by the
+ *         Tracer. StartupAssetScope records both - a Tracer zone with the
+ *         asset ID and an asset load for the summary.
+ *
+ *         The profiler is active from ManagerHandler::init() until the
+ *         first ManagerHandler::process(), so the loading of the initial
+ *         scene is included. While inactive recording costs a single
+ *         pointer check.
+ */
+
+// System headers
+#include <cstdint>
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <vector>
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+
+class StartupProfiler {
+public:
+  using Clock = std::chrono::steady_clock;
+
+  StartupProfiler();
+
+  /** @brief used to start a new profile
+   *
+   *  @param const uint32_t - how many of the slowest assets to report
+   * */
+  void start(const uint32_t topSlowestAssetsCount);
+
+  /** @brief used to stop the profile. Recording is ignored afterwards.
+   * */
+  void stop();
+
+  bool isActive() const {
+    return _isActive.load(std::memory_order_relaxed);
+  }
+
+  /** @brief used to record an asset load, executed on the calling thread
+   *
+   *  @param const char *     - asset category (static storage duration)
+   *  @param const uint64_t   - asset ID (rsrcId, fontId, etc.)
+   *  @param const Clock::time_point - load start
+   *  @param const Clock::time_point - load end
+   * */
+  void recordAssetLoad(const char *category, const uint64_t assetId,
+                       const Clock::time_point startTime,
+                       const Clock::time_point endTime);
+
+  /** @brief used to log the total time and the slowest assets
+   * */
+  void logSummary();
+
+private:
+  struct AssetRecord {
+    const char *category = nullptr;
+    uint64_t assetId = 0;
+    int64_t startUs = 0;
+    int64_t durationUs = 0;
+  };
+
+  int64_t toUs(const Clock::time_point timePoint) const;
+
+  // sorts the asset records, slowest first. Must be called with the
+  // mutex held
+  void sortAssetsBySlowest();
+
+  std::mutex _mutex;
+
+  std::vector<AssetRecord> _assets;
+
+  Clock::time_point _startTime;
+  Clock::time_point _stopTime;
+  uint32_t _topSlowestAssetsCount;
+  std::atomic<bool> _isActive;
+};
+
+/** @brief records an asset load from its construction to its destruction
+ *         (as a Tracer zone and into the startup summary)
+ * */
+class StartupAssetScope {
+public:
+  StartupAssetScope(const char *category, const uint64_t assetId);
+  ~StartupAssetScope() noexcept;
+
+  StartupAssetScope(const StartupAssetScope &other) = delete;
+  StartupAssetScope &operator=(const StartupAssetScope &other) = delete;
+
+private:
+  StartupProfiler::Clock::time_point _startTime;
+  const char *_category;
+  uint64_t _assetId;
+  int64_t _traceStartNs;
+  bool _isRecording;
+};
+
+// set by the ManagerHandler while the startup is being profiled
+extern StartupProfiler *gStartupProfiler;
+
+#endif /* MANAGER_UTILS_STARTUPPROFILER_H_ */
@@ -0,0 +1,178 @@
+#ifndef MANAGER_UTILS_TEXTTEXTURECACHE_H_
+#define MANAGER_UTILS_TEXTTEXTURECACHE_H_
+
+/*
+ * TextTextureCache.h
+ *
+ *  Brief: Bookkeeping for the shared (reference counted) text textures.
+ *         Texts are keyed by (fontId, content hash, color). Identical texts
+ *         share a single textId (GPU texture).
+ *
+ *         Texts that are no longer referenced are retained in a LRU list
+ *         (up to a limit), so switching back to a recently used
+ *         content/color does not re-rasterize.
+ *
+ *         The cache does not load/unload textures itself. The RsrcMgr
+ *         does that according to the cache results.
+ */
+
+// System headers
+#include <cstdint>
+#include <list>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+// Other libraries headers
+#include "utils/drawing/Color.h"
+
+// Own components headers
+
+// Forward declarations
+
+struct TextCacheStats {
+  uint64_t hits = 0;
+  uint64_t misses = 0;
+
+  // texture bytes that are currently not allocated thanks to the sharing.
+  // Each text sharing a texture with others is counted once
+  uint64_t bytesSaved = 0;
+
+  uint32_t cachedTextsCount = 0;
+  uint32_t retainedTextsCount = 0;
+
+  double getHitRate() const {
+    const uint64_t total = hits + misses;
+    return (0 == total) ?
+        0.0 : static_cast<double>(hits) / static_cast<double>(total);
+  }
+};
+
+struct CachedTextData {
+  int32_t textId = 0;
+  int32_t width = 0;
+  int32_t height = 0;
+};
+
+class TextTextureCache {
+public:
+  TextTextureCache();
+
+  /** @brief used to acquire a reference to an already cached text
+   *
+   *  @param const uint64_t   - unique font ID
+   *  @param const char *     - text content
+   *  @param const Color &    - text color
+   *  @param CachedTextData & - the cached text data (on hit)
+   *
+   *  @return bool - is cache hit
+   * */
+  bool acquire(const uint64_t fontId, const char *text, const Color &color,
+               CachedTextData &outData);
+
+  /** @brief used to add a newly loaded text with a single reference.
+   *         If the key could not be inserted (hash collision) the text
+   *         stays private (not cached).
+   * */
+  void insert(const uint64_t fontId, const char *text, const Color &color,
+              const CachedTextData &data);
+
+  /** @brief used to release a reference to a text
+   *
+   *  @param const int32_t          - unique text ID
+   *  @param std::vector<int32_t> & - text IDs that should be unloaded
+   *                                  (the released one, if it is not cached
+   *                                  and evicted retained texts)
+   * */
+  void release(const int32_t textId, std::vector<int32_t> &outUnloadTextIds);
+
+  /** @brief used to remove a text from the cache, so it could be modified
+   *         without affecting other texts (alpha modulation)
+   *
+   *  @param const int32_t - unique text ID
+   *
+   *  @return bool - true if the text is still used by others. In this case
+   *                 the caller should load a private copy of it.
+   * */
+  bool detach(const int32_t textId);
+
+  /** @brief used to restore the reference, released with ::detach(),
+   *         when a private copy of the text could not be loaded.
+   *         Does not count as a cache hit.
+   *
+   *  @param const int32_t - unique text ID
+   * */
+  void reattach(const int32_t textId);
+
+  /** @brief used to acquire what a cached text was created from
+   *
+   *  @return bool - is the text cached
+   * */
+  bool getTextSource(const int32_t textId, uint64_t &outFontId,
+                     std::string &outContent, Color &outColor) const;
+
+  bool isCached(const int32_t textId) const {
+    return _entries.end() != _entries.find(textId);
+  }
+
+  /** @brief used to drop every entry
+   *
+   *  @param std::vector<int32_t> & - text IDs that should be unloaded
+   *                                  (the retained ones)
+   * */
+  void clear(std::vector<int32_t> &outUnloadTextIds);
+
+  void setMaxRetainedTexts(const uint32_t maxRetainedTexts);
+
+  TextCacheStats getStats() const;
+
+private:
+  struct Key {
+    uint64_t fontId = 0;
+    uint64_t contentHash = 0;
+    Color color = Colors::BLACK;
+
+    bool operator==(const Key &other) const {
+      return (fontId == other.fontId) && (contentHash == other.contentHash) &&
+             (color == other.color);
+    }
+  };
+
+  struct KeyHash {
+    size_t operator()(const Key &key) const;
+  };
+
+  struct Entry {
+    Key key;
+    std::string content;
+    CachedTextData data;
+    uint32_t refCount = 0;
+
+    // valid only for retained (not referenced) entries
+    std::list<int32_t>::iterator retainedIt;
+  };
+
+  static Key makeKey(const uint64_t fontId, const char *text,
+                     const Color &color);
+
+  void evictRetained(const uint32_t maxRetained,
+                     std::vector<int32_t> &outUnloadTextIds);
+
+  void removeEntry(const int32_t textId);
+
+  static uint64_t getTextureBytes(const CachedTextData &data);
+
+  std::unordered_map<Key, int32_t, KeyHash> _keyToTextId;
+  std::unordered_map<int32_t, Entry> _entries;
+
+  // not referenced entries. Front is the least recently used
+  std::list<int32_t> _retainedTextIds;
+
+  uint32_t _maxRetainedTexts;
+
+  uint64_t _hits;
+  uint64_t _misses;
+  uint64_t _bytesSaved;
+};
+
+#endif /* MANAGER_UTILS_TEXTTEXTURECACHE_H_ */
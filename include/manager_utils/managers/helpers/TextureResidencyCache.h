@@ -0,0 +1,170 @@
+#ifndef MANAGER_UTILS_TEXTURERESIDENCYCACHE_H_
+#define MANAGER_UTILS_TEXTURERESIDENCYCACHE_H_
+
+/*
+ * TextureResidencyCache.h
+ *
+ *  Brief: Residency bookkeeping for the on-demand resource textures.
+ *
+ *         On-demand textures that are no longer referenced are not
+ *         unloaded immediately. They stay resident in a LRU list while
+ *         the resident on-demand textures fit in the VRAM budget.
+ *         Exceeding the budget evicts the least recently used ones.
+ *         Re-acquiring a retained texture is a cache hit (no reload).
+ *
+ *         Textures, loaded by an asynchronous batch, are tracked as
+ *         "loading" until the batch is completed. Loading textures are
+ *         never evicted.
+ *
+ *         The cache does not load/unload textures itself. The RsrcMgr
+ *         does that according to the cache results.
+ */
+
+// System headers
+#include <cstdint>
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Other libraries headers
+
+// Own components headers
+
+// Forward declarations
+
+struct TextureResidencyStats {
+  // retained textures that were acquired again (no reload)
+  uint64_t hits = 0;
+
+  // textures that had to be loaded
+  uint64_t misses = 0;
+  uint64_t evictions = 0;
+
+  // all on-demand textures, tracked by the cache (referenced + retained)
+  uint64_t residentBytes = 0;
+  uint64_t retainedBytes = 0;
+  uint64_t vramBudgetBytes = 0;
+
+  uint32_t retainedTexturesCount = 0;
+  uint32_t referencedTexturesCount = 0;
+
+  // sum of the reference counts of all referenced textures
+  uint64_t totalRefCount = 0;
+
+  double getHitRate() const {
+    const uint64_t total = hits + misses;
+    return (0 == total) ?
+        0.0 : static_cast<double>(hits) / static_cast<double>(total);
+  }
+};
+
+class TextureResidencyCache {
+public:
+  TextureResidencyCache();
+
+  /** @brief used to acquire a reference to an already tracked
+   *         (referenced or retained) on-demand texture. O(1)
+   *
+   *  @param const uint64_t - unique resource ID
+   *
+   *  @return bool - is the texture tracked. Otherwise ::insert() must
+   *                 follow together with the texture load
+   * */
+  bool acquire(const uint64_t rsrcId);
+
+  /** @brief used to start tracking a newly loaded texture with a single
+   *         reference
+   *
+   *  @param const uint64_t - unique resource ID
+   *  @param const uint64_t - texture size in bytes
+   *  @param const bool     - is the texture loaded asynchronously.
+   *                          If true ::onLoaded() must follow once
+   *                          the texture is uploaded
+   * */
+  void insert(const uint64_t rsrcId, const uint64_t textureBytes,
+              const bool isLoading);
+
+  /** @brief used to mark an asynchronously loaded texture as resident
+   *
+   *  @param const uint64_t - unique resource ID
+   * */
+  void onLoaded(const uint64_t rsrcId);
+
+  /** @brief used to check whether a texture is still being loaded
+   *         (false for not tracked textures)
+   * */
+  bool isLoading(const uint64_t rsrcId) const;
+
+  /** @brief used to release a reference to an on-demand texture.
+   *         The last reference does not unload the texture, it is
+   *         retained instead.
+   *
+   *  @param const uint64_t - unique resource ID
+   *
+   *  @return bool - is unload needed (true for not tracked textures)
+   * */
+  bool release(const uint64_t rsrcId);
+
+  /** @brief used to collect the retained textures, which should be
+   *         evicted in order to fit in the VRAM budget.
+   *         Loading textures are skipped
+   *
+   *  @param std::vector<uint64_t> & - rsrcIds to be unloaded
+   * */
+  void collectEvictions(std::vector<uint64_t> &outRsrcIds);
+
+  /** @brief used to forget every texture
+   *
+   *  @param std::vector<uint64_t> & - retained rsrcIds to be unloaded
+   * */
+  void clear(std::vector<uint64_t> &outRsrcIds);
+
+  /** @brief used to acquire the reference count of a texture
+   *         (0 for retained and not tracked textures)
+   * */
+  uint32_t getRefCount(const uint64_t rsrcId) const;
+
+  /** @brief used to collect every referenced texture with its reference
+   *         count. Intended for leak debugging
+   *
+   *  @param std::vector<std::pair<uint64_t, uint32_t>> &
+   *                                             - (rsrcId, refCount) pairs
+   * */
+  void collectRefCounts(
+      std::vector<std::pair<uint64_t, uint32_t>> &outRefCounts) const;
+
+  void setVramBudget(const uint64_t vramBudgetBytes) {
+    _vramBudgetBytes = vramBudgetBytes;
+  }
+
+  TextureResidencyStats getStats() const;
+
+private:
+  struct Entry {
+    uint64_t textureBytes = 0;
+    uint32_t refCount = 0;
+    bool isLoading = false;
+
+    // valid only for retained entries (refCount == 0)
+    std::list<uint64_t>::iterator lruIt;
+  };
+
+  std::unordered_map<uint64_t, Entry> _entries;
+
+  // retained (not referenced) rsrcIds. Most recently used at the front
+  std::list<uint64_t> _lru;
+
+  uint64_t _vramBudgetBytes;
+  uint64_t _residentBytes;
+  uint64_t _retainedBytes;
+
+  uint64_t _totalRefCount;
+  uint32_t _referencedCount;
+
+  uint64_t _hits;
+  uint64_t _misses;
+  uint64_t _evictions;
+};
+
+#endif /* MANAGER_UTILS_TEXTURERESIDENCYCACHE_H_ */
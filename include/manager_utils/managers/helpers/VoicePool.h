@@ -0,0 +1,158 @@
+#ifndef MANAGER_UTILS_VOICEPOOL_H_
+#define MANAGER_UTILS_VOICEPOOL_H_
+
+/*
+ * VoicePool.h
+ *
+ *  Brief: Bookkeeping for the sound channels (voices) of the SoundMgr.
+ *
+ *         - free voices are kept in a free-list -> O(1) allocation;
+ *         - busy voices are kept in per-priority lists ordered by their
+ *           start time -> the steal victim (the oldest voice with the
+ *           lowest priority) is found in O(priorities count);
+ *         - busy voices with the same rsrcId are chained together and
+ *           indexed by the rsrcId.
+ *
+ *         Voices [0, reservedVoicesCount) are never allocated.
+ *         The class does not talk to SDL_mixer. Stopping a stolen voice is
+ *         a responsibility of the caller.
+ */
+
+// System headers
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+// Other libraries headers
+#include "utils/ErrorCode.h"
+
+// Own components headers
+#include "manager_utils/managers/defines/SoundMgrDefines.h"
+
+// Forward declarations
+
+class VoicePool {
+public:
+  static constexpr int32_t INVALID_VOICE = -1;
+
+  VoicePool();
+
+  /** @brief used to allocate the voices bookkeeping
+   *
+   *  @param const int32_t - total voices count
+   *  @param const int32_t - leading voices, which are never allocated
+   *
+   *  @return ErrorCode - error code
+   * */
+  ErrorCode init(const int32_t voicesCount, const int32_t reservedVoicesCount);
+
+  void deinit();
+
+  /** @brief used to acquire a free voice
+   *
+   *  @param const uint64_t      - resource ID, which will be played
+   *  @param const SoundPriority - priority of the sound
+   *
+   *  @return int32_t - the voice or INVALID_VOICE if none is free
+   * */
+  int32_t allocate(const uint64_t rsrcId, const SoundPriority priority);
+
+  /** @brief used to find the voice, which should be stolen for a sound
+   *         with the provided priority. The voice is not released.
+   *
+   *  @param const SoundPriority - priority of the new sound
+   *
+   *  @return int32_t - the victim voice or INVALID_VOICE if all busy
+   *                    voices have higher priority
+   * */
+  int32_t findStealCandidate(const SoundPriority priority) const;
+
+  /** @brief used to return a busy voice to the free-list.
+   *         Releasing a free or a reserved voice is a no-op.
+   * */
+  void release(const int32_t voice);
+
+  bool isBusy(const int32_t voice) const;
+
+  /** @return uint64_t - rsrcId of a busy voice or 0
+   * */
+  uint64_t getRsrcId(const int32_t voice) const;
+
+  /** @brief used to find the most recently started voice for the rsrcId
+   *
+   *  @return int32_t - the voice or INVALID_VOICE
+   * */
+  int32_t findVoice(const uint64_t rsrcId) const;
+
+  /** @return int32_t - number of busy voices for the rsrcId
+   * */
+  int32_t getInstancesCount(const uint64_t rsrcId) const;
+
+  /** @brief used to iterate the next (older) voice of the same rsrcId
+   *
+   *  @return int32_t - the voice or INVALID_VOICE
+   * */
+  int32_t getNextSameRsrcVoice(const int32_t voice) const;
+
+  void onVoiceStolen() {
+    ++_stats.stolenVoicesCount;
+  }
+
+  void onSoundDropped() {
+    ++_stats.droppedSoundsCount;
+  }
+
+  int32_t getVoicesCount() const {
+    return static_cast<int32_t>(_voices.size());
+  }
+
+  const VoicePoolStats &getStats() const {
+    return _stats;
+  }
+
+private:
+  struct Voice {
+    uint64_t rsrcId = 0;
+
+    // free-list or priority list links
+    int32_t prev = INVALID_VOICE;
+    int32_t next = INVALID_VOICE;
+
+    // same rsrcId links
+    int32_t prevSameRsrc = INVALID_VOICE;
+    int32_t nextSameRsrc = INVALID_VOICE;
+
+    SoundPriority priority = SoundPriority::NORMAL;
+    bool isBusy = false;
+  };
+
+  struct VoiceList {
+    int32_t head = INVALID_VOICE;
+    int32_t tail = INVALID_VOICE;
+  };
+
+  struct RsrcVoices {
+    // most recently started voice
+    int32_t head = INVALID_VOICE;
+    int32_t instancesCount = 0;
+  };
+
+  void pushBack(VoiceList &list, const int32_t voice);
+
+  void unlink(VoiceList &list, const int32_t voice);
+
+  std::vector<Voice> _voices;
+
+  VoiceList _freeList;
+
+  // ordered from the oldest to the newest
+  VoiceList _busyLists[static_cast<int32_t>(SoundPriority::COUNT)];
+
+  std::unordered_map<uint64_t, RsrcVoices> _rsrcVoices;
+
+  int32_t _reservedVoicesCount;
+
+  VoicePoolStats _stats;
+};
+
+#endif /* MANAGER_UTILS_VOICEPOOL_H_ */
@@ -0,0 +1,82 @@
+#ifndef MANAGER_UTILS_FIXEDBLOCKPOOL_H_
+#define MANAGER_UTILS_FIXEDBLOCKPOOL_H_
+
+/*
+ * FixedBlockPool.h
+ *
+ *  Brief: Thread-safe pool of equally sized memory blocks.
+ *         Memory is reserved in chunks of blocks and is never returned
+ *         to the system until the pool is destroyed. Freed blocks are kept
+ *         in an intrusive free list, so allocation and deallocation are O(1)
+ *         and do not touch the global heap.
+ */
+
+// System headers
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// Other libraries headers
+#include "utils/class/NonCopyable.h"
+#include "utils/class/NonMoveable.h"
+
+// Own components headers
+
+// Forward declarations
+
+class FixedBlockPool : public NonCopyable, public NonMoveable {
+public:
+  /** @param const size_t - size of a single block in bytes
+   *                        (rounded up to max_align_t alignment)
+   *  @param const size_t - number of blocks reserved at once
+   * */
+  FixedBlockPool(const size_t blockSize, const size_t blocksPerChunk);
+
+  ~FixedBlockPool() noexcept;
+
+  /** @brief used to acquire a block
+   *
+   *  @return void * - the block (nullptr on bad alloc)
+   * */
+  void *allocate();
+
+  /** @brief used to return a block, acquired with ::allocate()
+   *
+   *  @param void * - the block
+   * */
+  void deallocate(void *block);
+
+  size_t getBlockSize() const {
+    return _blockSize;
+  }
+
+  uint64_t getAllocationsCount() const;
+
+  uint64_t getLiveBlocksCount() const;
+
+  uint64_t getPeakLiveBlocksCount() const;
+
+  uint64_t getReservedBytes() const;
+
+private:
+  struct FreeBlock {
+    FreeBlock *next;
+  };
+
+  bool reserveChunk();
+
+  mutable std::mutex _mutex;
+
+  std::vector<uint8_t *> _chunks;
+  FreeBlock *_freeList;
+
+  const size_t _blockSize;
+  const size_t _blocksPerChunk;
+
+  uint64_t _allocationsCount;
+  uint64_t _liveBlocksCount;
+  uint64_t _peakLiveBlocksCount;
+};
+
+#endif /* MANAGER_UTILS_FIXEDBLOCKPOOL_H_ */
@@ -0,0 +1,118 @@
+#ifndef MANAGER_UTILS_MEMORYARENA_H_
+#define MANAGER_UTILS_MEMORYARENA_H_
+
+/*
+ * MemoryArena.h
+ *
+ *  Brief: Linear (bump) allocator, intended to be owned by a scene.
+ *         Allocations are not freed individually - the whole arena is
+ *         rewound with ::reset() (or given back to the system with
+ *         ::release()) once every object, allocated from it, is destroyed.
+ *
+ *         Activate the arena with ScopedWidgetArena (WidgetAllocator.h),
+ *         so the widget internals created in the scope are placed in it.
+ *
+ *         NOTE: allocations are not thread-safe. The arena should be used
+ *               by the thread that builds the scene.
+ */
+
+// System headers
+#include <cstddef>
+#include <cstdint>
+#include <atomic>
+#include <vector>
+
+// Other libraries headers
+#include "utils/class/NonCopyable.h"
+#include "utils/class/NonMoveable.h"
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+
+class MemoryArena : public NonCopyable, public NonMoveable {
+public:
+  /** @param const size_t - size of a single memory chunk. Requests, bigger
+   *                        than the chunk size receive a dedicated chunk
+   * */
+  explicit MemoryArena(const size_t chunkSize = 64 * 1024);
+
+  /** WARNING: objects allocated from the arena must be destroyed first.
+   *           Live allocations are logged and their memory is leaked
+   *           (debug builds assert)
+   * */
+  ~MemoryArena() noexcept;
+
+  /** @brief used to acquire memory aligned to max_align_t
+   *
+   *  @param const size_t - requested bytes
+   *
+   *  @return void * - the memory (nullptr on bad alloc)
+   * */
+  void *allocate(const size_t bytes);
+
+  /** @brief used to mark a single allocation as no longer used.
+   *         The memory itself is reclaimed on ::reset()
+   * */
+  void onDeallocate() {
+    --_liveAllocationsCount;
+  }
+
+  /** @brief used to rewind the arena. The reserved chunks are kept
+   *         for reuse.
+   *
+   *  @return ErrorCode - error code (fails if there are live allocations)
+   * */
+  ErrorCode reset();
+
+  /** @brief used to rewind the arena and return the chunks to the system
+   *
+   *  @return ErrorCode - error code (fails if there are live allocations)
+   * */
+  ErrorCode release();
+
+  uint64_t getAllocationsCount() const {
+    return _allocationsCount;
+  }
+
+  uint64_t getLiveAllocationsCount() const {
+    return _liveAllocationsCount;
+  }
+
+  uint64_t getUsedBytes() const {
+    return _usedBytes;
+  }
+
+  uint64_t getReservedBytes() const {
+    return _reservedBytes;
+  }
+
+private:
+  struct Chunk {
+    uint8_t *memory = nullptr;
+    size_t size = 0;
+  };
+
+  bool reserveChunk(const size_t minBytes);
+
+  void freeChunks();
+
+  std::vector<Chunk> _chunks;
+
+  // index of the chunk currently being filled and the offset in it
+  size_t _currChunkIdx;
+  size_t _currChunkOffset;
+
+  const size_t _chunkSize;
+
+  uint64_t _allocationsCount;
+
+  // deallocations may come from different threads
+  std::atomic<uint64_t> _liveAllocationsCount;
+
+  uint64_t _usedBytes;
+  uint64_t _reservedBytes;
+};
+
+#endif /* MANAGER_UTILS_MEMORYARENA_H_ */
@@ -0,0 +1,129 @@
+#ifndef MANAGER_UTILS_WIDGETALLOCATOR_H_
+#define MANAGER_UTILS_WIDGETALLOCATOR_H_
+
+/*
+ * WidgetAllocator.h
+ *
+ *  Brief: Allocation facility for the widget internals (text content,
+ *         animation images, etc.).
+ *
+ *         Requests are served from:
+ *           - the active MemoryArena of the calling thread (if such is
+ *             activated with ScopedWidgetArena);
+ *           - size-class FixedBlockPools (for small requests);
+ *           - the global heap (for requests bigger than the largest
+ *             size class).
+ *
+ *         Every allocation is prefixed with a small header, so
+ *         ::deallocate() knows where the memory came from.
+ *
+ *         Example:
+ *               MemoryArena sceneArena;
+ *               {
+ *                 ScopedWidgetArena arenaScope(sceneArena);
+ *                 //create the scene widgets
+ *               }
+ *
+ *               //destroy the scene widgets
+ *               sceneArena.reset(); //frees all scene allocations in bulk
+ */
+
+// System headers
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+// Other libraries headers
+#include "utils/class/NonCopyable.h"
+#include "utils/class/NonMoveable.h"
+
+// Own components headers
+
+// Forward declarations
+class MemoryArena;
+
+struct WidgetAllocatorStats {
+  uint64_t poolAllocations = 0;
+  uint64_t arenaAllocations = 0;
+  uint64_t heapAllocations = 0;
+  uint64_t deallocations = 0;
+  uint64_t liveAllocations = 0;
+  uint64_t poolReservedBytes = 0;
+};
+
+class WidgetAllocator {
+public:
+  WidgetAllocator() = delete;
+
+  /** @brief used to acquire memory aligned to max_align_t
+   *
+   *  @param const size_t - requested bytes
+   *
+   *  @return void * - the memory (nullptr on bad alloc)
+   * */
+  static void *allocate(const size_t bytes);
+
+  /** @brief used to return memory, acquired with ::allocate()
+   *
+   *  @param void * - the memory. nullptr is allowed
+   * */
+  static void deallocate(void *memory);
+
+  /** @brief used to obtain the bytes that could be used in the allocation.
+   *         They could be more than the requested ones (size classes)
+   *
+   *  @param const void * - the memory
+   *
+   *  @return size_t - usable bytes
+   * */
+  static size_t getUsableSize(const void *memory);
+
+  template <typename T, typename ... Args>
+  static T *create(Args &&... args) {
+    void *memory = allocate(sizeof(T));
+    if (nullptr == memory) {
+      return nullptr;
+    }
+    return new (memory) T(std::forward<Args>(args)...);
+  }
+
+  template <typename T>
+  static void destroy(T *object) {
+    if (nullptr != object) {
+      object->~T();
+      deallocate(object);
+    }
+  }
+
+  /** @brief used to activate an arena for the calling thread.
+   *
+   *  @param MemoryArena * - the arena. nullptr deactivates the arenas
+   *
+   *  @return MemoryArena * - the previously active arena
+   * */
+  static MemoryArena *setActiveArena(MemoryArena *arena);
+
+  /** @brief used to acquire the allocation counters (for profiling)
+   * */
+  static WidgetAllocatorStats getStats();
+};
+
+/** @brief activates an arena for the calling thread for the lifetime
+ *         of the scope object
+ * */
+class ScopedWidgetArena : public NonCopyable, public NonMoveable {
+public:
+  explicit ScopedWidgetArena(MemoryArena &arena)
+      : _prevArena(WidgetAllocator::setActiveArena(&arena)) {
+  }
+
+  ~ScopedWidgetArena() noexcept {
+    WidgetAllocator::setActiveArena(_prevArena);
+  }
+
+private:
+  MemoryArena *_prevArena;
+};
+
+#endif /* MANAGER_UTILS_WIDGETALLOCATOR_H_ */
@@ -9,7 +9,11 @@
  *         Definitions:
  *              > Chunks/Sounds:
  *                       - Big numbers of sounds can be played simultaneously
- *                                  (check SoundMgr::_SUPPORTED_SOUND_CHANNELS);
+ *                                       (check SoundMgrConfig::voicesCount);
+ *
+ *                       - When all sound channels are busy, sounds with
+ *                         higher priority steal the channels of the older
+ *                         lower priority ones (check ::setPriority());
  *
  *                       - Chunks/Sounds are loaded into memory;
  *
@@ -31,6 +35,7 @@
 // Other libraries headers
 
 // Own components headers
+#include "manager_utils/managers/defines/SoundMgrDefines.h"
 #include "manager_utils/sound/SoundWidget.h"
 
 class Sound : public SoundWidget {
@@ -105,6 +110,19 @@ class Sound : public SoundWidget {
    * */
   void playWithPanning(const int32_t loops, const int32_t leftVolume,
                        const int32_t rightVolume);
+
+  /** @brief used to set the priority, with which the Sound is played
+   *         from now on. Important cues should use a higher priority,
+   *         so bursts of less important sounds never steal their channels
+   *
+   *  @param const SoundPriority - priority of the sound
+   * */
+  void setPriority(const SoundPriority priority) { _priority = priority; }
+
+  SoundPriority getPriority() const { return _priority; }
+
+ private:
+  SoundPriority _priority = SoundPriority::NORMAL;
 };
 
 #endif /* MANAGER_UTILS_SOUND_H_ */
@@ -0,0 +1,130 @@
+#ifndef MANAGER_UTILS_TRACER_H_
+#define MANAGER_UTILS_TRACER_H_
+
+/*
+ * Tracer.h
+ *
+ *  Brief: Lightweight scoped trace zones for the update, render and any
+ *         other thread.
+ *
+ *         Every thread records into its own lock-free single producer,
+ *         single consumer ring buffer, so recording never blocks.
+ *         Events that do not fit in a full ring are dropped (and counted).
+ *         The rings of exited threads are reused once they are drained.
+ *         ::flushChromeTrace() drains all rings into a Chrome trace JSON,
+ *         which can be opened with chrome://tracing or Perfetto.
+ *
+ *         Tracing is enabled at runtime. While disabled a TraceZone costs
+ *         a single relaxed atomic load.
+ *
+ *         Example:
+ *               void SomeMgr::process() {
+ *                 const TraceZone zone("SomeMgr::process");
+ *                 //...
+ *               }
+ */
+
+// System headers
+#include <cstdint>
+#include <atomic>
+
+// Other libraries headers
+#include "utils/ErrorCode.h"
+
+// Own components headers
+
+// Forward declarations
+
+class Tracer {
+public:
+  Tracer() = delete;
+
+  /** @brief used to start recording
+   *
+   *  @param const uint32_t - ring capacity (in events) for the threads
+   *                          that start recording afterwards. Rounded up
+   *                          to a power of 2
+   * */
+  static void enable(const uint32_t eventsPerThread = 64 * 1024);
+
+  static void disable();
+
+  static bool isEnabled() {
+    return _isEnabled.load(std::memory_order_relaxed);
+  }
+
+  /** @brief used to name the calling thread in the trace
+   *
+   *  @param const char * - thread name (static storage duration)
+   * */
+  static void setThreadName(const char *name);
+
+  /** @brief used to record a zone for the calling thread
+   *
+   *  @param const char *  - zone name (static storage duration)
+   *  @param const int64_t - zone start (::now())
+   *  @param const int64_t - zone end (::now())
+   * */
+  static void record(const char *name, const int64_t startNs,
+                     const int64_t endNs);
+
+  /** @brief used to record a zone for the calling thread, which refers
+   *         to a specific object (rsrcId, fontId, etc.). The ID is shown
+   *         in the zone arguments, so the per-object cost could be
+   *         inspected in the trace
+   *
+   *  @param const char *   - zone name (static storage duration)
+   *  @param const int64_t  - zone start (::now())
+   *  @param const int64_t  - zone end (::now())
+   *  @param const uint64_t - object ID
+   * */
+  static void record(const char *name, const int64_t startNs,
+                     const int64_t endNs, const uint64_t id);
+
+  /** @brief used to acquire the current trace time
+   *
+   *  @return int64_t - nanoseconds
+   * */
+  static int64_t now();
+
+  /** @brief used to drain the recorded events of all threads into
+   *         a Chrome trace JSON file. The events are appended, so the
+   *         function could be called periodically during a session.
+   *         Remove the file before the first flush of a new session.
+   *
+   *  @param const char * - output file path
+   *
+   *  @return ErrorCode - error code
+   * */
+  static ErrorCode flushChromeTrace(const char *file);
+
+  /** @brief used to acquire the count of the events that were dropped,
+   *         because their ring was full
+   * */
+  static uint64_t getDroppedEventsCount();
+
+private:
+  static std::atomic<bool> _isEnabled;
+};
+
+class TraceZone {
+public:
+  explicit TraceZone(const char *name)
+      : _name(name), _startNs(Tracer::isEnabled() ? Tracer::now() : -1) {
+  }
+
+  ~TraceZone() noexcept {
+    if (0 <= _startNs) {
+      Tracer::record(_name, _startNs, Tracer::now());
+    }
+  }
+
+  TraceZone(const TraceZone &other) = delete;
+  TraceZone &operator=(const TraceZone &other) = delete;
+
+private:
+  const char *_name;
+  int64_t _startNs;
+};
+
+#endif /* MANAGER_UTILS_TRACER_H_ */
@@ -11,17 +11,29 @@
 #include "utils/log/Log.h"
 
 // Own components headers
+#include "manager_utils/managers/DrawMgr.h"
 #include "manager_utils/managers/RsrcMgr.h"
-#include "manager_utils/drawing/Sprite.h"
+
+DynamicImage::DynamicImage() : _streamTicket(0) {}
 
 DynamicImage::DynamicImage(DynamicImage&& movedOther)
-    : Image(std::move(movedOther)) {}
+    : Image(std::move(movedOther)),
+      _rsrcHandle(std::move(movedOther._rsrcHandle)),
+      _streamTicket(movedOther._streamTicket) {
+  movedOther._streamTicket = 0;
+}
 
 DynamicImage& DynamicImage::operator=(DynamicImage&& movedOther) {
   // check for self-assignment
   if (this != &movedOther) {
+    cancelAsyncRequest();
+
     // explicitly invoke Image's move assignment operator
     Image::operator=(std::move(movedOther));
+
+    _rsrcHandle = std::move(movedOther._rsrcHandle);
+    _streamTicket = movedOther._streamTicket;
+    movedOther._streamTicket = 0;
   }
 
   return *this;
@@ -32,6 +44,8 @@ DynamicImage::~DynamicImage() {
   // and not destroyed
   if (true == _isCreated && false == _isDestroyed) {
     DynamicImage::destroy();
+  } else {
+    cancelAsyncRequest();
   }
 }
 
@@ -44,23 +58,75 @@ void DynamicImage::create(const uint64_t rsrcId) {
     return;
   }
 
-  gRsrcMgr->loadResourceOnDemandSingle(rsrcId);
-  const ResourceData* rsrcData = nullptr;
-  if (ErrorCode::SUCCESS != gRsrcMgr->getRsrcData(rsrcId, rsrcData)) {
+  if (isAsyncRequestPending()) {
+    LOGERR("Error, Image has a pending async create. Will not create "
+           "rsrcId: %" PRIu64, rsrcId);
+    return;
+  }
+
+  _rsrcHandle.acquire(rsrcId);
+  if (ErrorCode::SUCCESS != applyRsrcData(rsrcId)) {
+    _rsrcHandle.release();
+  }
+}
+
+void DynamicImage::createAsync(const uint64_t rsrcId, const int32_t priority,
+                               const int64_t deadlineMs) {
+  if (_isCreated || isAsyncRequestPending()) {
     LOGERR(
-        "Error, getRsrcData failed for rsrcId: %" PRIu64", "
-        "will not create Image",
+        "Error, Image with rsrcId: %" PRIu64" already created,"
+        " will not create twice",
         rsrcId);
-    gRsrcMgr->unloadResourceOnDemandSingle(rsrcId);
     return;
   }
 
-  _sprites = new Sprite();
-  if (nullptr == _sprites) {
-    LOGERR("Warning bad alloc for sprites for rsrcId: %" PRIu64, rsrcId);
+  _drawParams.rsrcId = rsrcId;
+  _streamTicket = gRsrcMgr->loadResourceAsync(rsrcId, priority, deadlineMs);
+}
+
+void DynamicImage::process() {
+  if (!isAsyncRequestPending()) {
+    return;
+  }
+
+  const StreamRequestState state = gRsrcMgr->pollResourceAsync(_streamTicket);
+  if (StreamRequestState::PENDING == state) {
+    return;
+  }
+  _streamTicket = 0;
+
+  if (StreamRequestState::FAILED == state) {
+    LOGERR("Error, async load failed for rsrcId: %" PRIu64,
+           _drawParams.rsrcId);
+    return;
+  }
+
+  // the stream request reference is owned by the DynamicImage from now on
+  _rsrcHandle.adopt(_drawParams.rsrcId);
+  if (ErrorCode::SUCCESS != applyRsrcData(_drawParams.rsrcId)) {
+    _rsrcHandle.release();
+  }
+}
+
+void DynamicImage::draw() const {
+  // a DynamicImage with pending ::createAsync() has nothing to draw yet
+  if (!_isCreated) {
     return;
   }
 
+  Widget::draw();
+}
+
+ErrorCode DynamicImage::applyRsrcData(const uint64_t rsrcId) {
+  const ResourceData* rsrcData = nullptr;
+  if (ErrorCode::SUCCESS != gRsrcMgr->getRsrcData(rsrcId, rsrcData)) {
+    LOGERR(
+        "Error, getRsrcData failed for rsrcId: %" PRIu64", "
+        "will not create Image",
+        rsrcId);
+    return ErrorCode::FAILURE;
+  }
+
   _isCreated = true;
   _isDestroyed = false;
 
@@ -72,7 +138,7 @@ void DynamicImage::create(const uint64_t rsrcId) {
   _imageWidth = rsrcData->imageRect.w;
   _imageHeight = rsrcData->imageRect.h;
 
-  _sprites->init(rsrcId, rsrcData->spriteData);
+  _sprite.init(rsrcId, rsrcData->spriteData);
 
   /** Explicitly call setFrameRect() method in order to invoke any
    * crop modification (if such is enabled)
@@ -83,7 +149,21 @@ void DynamicImage::create(const uint64_t rsrcId) {
    *           single sprite in it with
    *           frameRect.x = 0 and frameRect.y = 0.
    * */
-  setFrameRect(_sprites->getFrameRect());
+  setFrameRect(_sprite.getFrameRect());
+
+  return ErrorCode::SUCCESS;
+}
+
+void DynamicImage::cancelAsyncRequest() {
+  if (!isAsyncRequestPending()) {
+    return;
+  }
+
+  // sanity check, because manager could already been destroyed
+  if (nullptr != gRsrcMgr) {
+    gRsrcMgr->cancelResourceAsync(_streamTicket);
+  }
+  _streamTicket = 0;
 }
 
 void DynamicImage::destroy() {
@@ -93,20 +173,19 @@ void DynamicImage::destroy() {
     return;
   }
 
-  // make a sanity check, because gRsrcMgrBase might already be destroyed in
-  // case of application shutdown and chain of destructor calls
-  if (gRsrcMgr) {
-    gRsrcMgr->unloadResourceOnDemandSingle(_drawParams.rsrcId);
+  // the last reference hands the texture to the RsrcMgr residency cache
+  _rsrcHandle.release();
+
+  // the resource texture could be shared with other Image objects ->
+  // only forget the cached renderer state, since the texture will be
+  // re-created with default state if it is loaded again
+  if (gDrawMgr) {
+    gDrawMgr->onTextureRecreated(WidgetType::IMAGE, _drawParams.rsrcId);
   }
 
   _isDestroyed = true;
 
   Widget::reset();
 
-  if (_sprites) { // Sanity check
-    _sprites->deinit();
-
-    delete _sprites;
-    _sprites = nullptr;
-  }
+  _sprite.deinit();
 }
@@ -13,6 +13,7 @@
 // Own components headers
 #include "manager_utils/managers/DrawMgr.h"
 #include "manager_utils/managers/RsrcMgr.h"
+#include "manager_utils/trace/Tracer.h"
 
 Fbo::Fbo()
     : _clearColor(Colors::BLACK),
@@ -110,6 +111,9 @@ void Fbo::create(const int32_t coordinateX,
 
   gRsrcMgr->createFbo(spriteBufferWidth, spriteBufferHeight,
                                _drawParams.spriteBufferId);
+  gDrawMgr->onTextureCreated(WidgetType::SPRITE_BUFFER,
+      static_cast<uint64_t>(_drawParams.spriteBufferId), spriteBufferWidth,
+      spriteBufferHeight);
 }
 
 void Fbo::create(const Rectangle& dimensions,
@@ -135,6 +139,11 @@ void Fbo::destroy() {
     gRsrcMgr->destroyFbo(_drawParams.spriteBufferId);
   }
 
+  if (nullptr != gDrawMgr) {
+    gDrawMgr->onTextureDestroyed(WidgetType::SPRITE_BUFFER,
+        static_cast<uint64_t>(_drawParams.spriteBufferId));
+  }
+
   Widget::reset();
   resetInternals();
 
@@ -234,6 +243,7 @@ void Fbo::addWidget(const Widget &widget) {
 }
 
 void Fbo::update() {
+  const TraceZone zone("Fbo::update");
   if (!_isCreated) {
     LOGERR("Error, SpriteBuffe::update() failed, because Fbo is not yet "
            "created. Consider using ::create() method first");
@@ -267,6 +277,7 @@ void Fbo::update() {
 
 void Fbo::updateRanged(const int32_t fromIndex,
                                 const int32_t toIndex) {
+  const TraceZone zone("Fbo::updateRanged");
   if (!_isCreated) {
     LOGERR("Error, Fbo::updateRanged() failed, because "
            "Fbo is not yet created. Consider using ::create() method first");
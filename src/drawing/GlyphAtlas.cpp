@@ -0,0 +1,147 @@
+// Corresponding header
+#include "manager_utils/drawing/GlyphAtlas.h"
+
+// System headers
+
+// Other libraries headers
+#include "utils/LimitValues.h"
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "manager_utils/managers/DrawMgr.h"
+
+namespace {
+constexpr int32_t ATLAS_WIDTH = 512;
+
+// transparent gap between the glyphs, so filtering does not bleed
+constexpr int32_t GLYPH_PADDING = 1;
+
+// frames after the upload, which are needed for the renderer to execute it
+constexpr uint64_t UPLOAD_COMPLETION_DELAY = 2;
+
+constexpr char FALLBACK_GLYPH = '?';
+}
+
+GlyphAtlas::GlyphAtlas()
+    : _uploadFrame(0), _fontId(INIT_UINT64_VALUE), _color(Colors::BLACK),
+      _lineHeight(0) {
+}
+
+GlyphAtlas::~GlyphAtlas() noexcept {
+  if (_atlasFbo.isCreated()) {
+    destroy();
+  }
+}
+
+ErrorCode GlyphAtlas::create(const uint64_t fontId, const Color &color) {
+  if (_atlasFbo.isCreated()) {
+    LOGERR("Error, GlyphAtlas for fontId: %" PRIu64" already created", _fontId);
+    return ErrorCode::FAILURE;
+  }
+
+  _fontId = fontId;
+  _color = color;
+  _lineHeight = 0;
+
+  // rasterize every glyph separately and pack them in rows
+  _glyphTexts.resize(GLYPHS_COUNT);
+  char glyphStr[2] = { 0, 0 };
+  int32_t penX = 0;
+  int32_t penY = 0;
+  int32_t rowHeight = 0;
+  for (int32_t i = 0; i < GLYPHS_COUNT; ++i) {
+    _glyphRects[i] = Rectangles::ZERO;
+
+    glyphStr[0] = static_cast<char>(FIRST_GLYPH + i);
+    Text &glyphText = _glyphTexts[i];
+    glyphText.create(fontId, glyphStr, color);
+    if (!glyphText.isCreated()) {
+      LOGERR("Warning, glyph: '%c' could not be rasterized for fontId: %"
+             PRIu64, glyphStr[0], fontId);
+      continue;
+    }
+
+    const int32_t glyphWidth = glyphText.getImageWidth();
+    const int32_t glyphHeight = glyphText.getImageHeight();
+    if (penX + glyphWidth > ATLAS_WIDTH) {
+      penX = 0;
+      penY += rowHeight + GLYPH_PADDING;
+      rowHeight = 0;
+    }
+
+    _glyphRects[i] = Rectangle(penX, penY, glyphWidth, glyphHeight);
+    glyphText.setPosition(penX, penY);
+
+    penX += glyphWidth + GLYPH_PADDING;
+    if (glyphHeight > rowHeight) {
+      rowHeight = glyphHeight;
+    }
+    if (glyphHeight > _lineHeight) {
+      _lineHeight = glyphHeight;
+    }
+  }
+
+  const int32_t atlasHeight = penY + rowHeight;
+  if (0 == atlasHeight) {
+    LOGERR("Error, no glyphs could be rasterized for fontId: %" PRIu64, fontId);
+    _glyphTexts.clear();
+    return ErrorCode::FAILURE;
+  }
+
+  _atlasFbo.create(0, 0, ATLAS_WIDTH, atlasHeight);
+  _atlasFbo.activateAlphaModulation();
+  _atlasFbo.setResetColor(Colors::FULL_TRANSPARENT);
+
+  _atlasFbo.unlock();
+  _atlasFbo.reset();
+  for (const Text &glyphText : _glyphTexts) {
+    if (glyphText.isCreated()) {
+      _atlasFbo.addWidget(glyphText);
+    }
+  }
+  _atlasFbo.update();
+  _atlasFbo.lock();
+
+  _uploadFrame = gDrawMgr->getFinishedFramesCount();
+
+  return ErrorCode::SUCCESS;
+}
+
+void GlyphAtlas::destroy() {
+  _glyphTexts.clear();
+
+  if (_atlasFbo.isCreated()) {
+    _atlasFbo.destroy();
+  }
+
+  _fontId = INIT_UINT64_VALUE;
+  _lineHeight = 0;
+}
+
+void GlyphAtlas::process() {
+  if (_glyphTexts.empty()) {
+    return;
+  }
+
+  // sanity check, because manager could already been destroyed
+  if ( (nullptr == gDrawMgr) || (gDrawMgr->getFinishedFramesCount() >=
+                                 _uploadFrame + UPLOAD_COMPLETION_DELAY)) {
+    _glyphTexts.clear();
+  }
+}
+
+bool GlyphAtlas::hasGlyph(const char glyph) const {
+  if ( (FIRST_GLYPH > glyph) || (LAST_GLYPH < glyph)) {
+    return false;
+  }
+
+  return 0 != _glyphRects[getGlyphIdx(glyph)].w;
+}
+
+const Rectangle &GlyphAtlas::getGlyphRect(const char glyph) const {
+  if (hasGlyph(glyph)) {
+    return _glyphRects[getGlyphIdx(glyph)];
+  }
+
+  return _glyphRects[getGlyphIdx(FALLBACK_GLYPH)];
+}
@@ -0,0 +1,192 @@
+// Corresponding header
+#include "manager_utils/drawing/GlyphText.h"
+
+// System headers
+#include <utility>
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "manager_utils/drawing/GlyphAtlas.h"
+#include "manager_utils/managers/DrawMgr.h"
+#include "manager_utils/managers/RsrcMgr.h"
+
+GlyphText::GlyphText()
+    : _atlas(nullptr), _pos(Points::ZERO), _width(0), _height(0),
+      _isCreated(false), _isVisible(true) {
+}
+
+GlyphText::~GlyphText() noexcept {
+  if (_isCreated) {
+    destroy();
+  }
+}
+
+GlyphText::GlyphText(GlyphText &&movedOther)
+    : _glyphs(std::move(movedOther._glyphs)),
+      _textContent(std::move(movedOther._textContent)),
+      _atlas(movedOther._atlas), _pos(movedOther._pos),
+      _width(movedOther._width), _height(movedOther._height),
+      _isCreated(movedOther._isCreated), _isVisible(movedOther._isVisible) {
+  // ownership of resource should be taken from moved instance
+  movedOther.resetInternals();
+}
+
+GlyphText& GlyphText::operator=(GlyphText &&movedOther) {
+  // check for self-assignment
+  if (this != &movedOther) {
+    if (_isCreated) {
+      destroy();
+    }
+
+    // take ownership of resources
+    _glyphs = std::move(movedOther._glyphs);
+    _textContent = std::move(movedOther._textContent);
+    _atlas = movedOther._atlas;
+    _pos = movedOther._pos;
+    _width = movedOther._width;
+    _height = movedOther._height;
+    _isCreated = movedOther._isCreated;
+    _isVisible = movedOther._isVisible;
+
+    // ownership of resource should be taken from moved instance
+    movedOther.resetInternals();
+  }
+
+  return *this;
+}
+
+void GlyphText::create(const uint64_t fontId, const char *text,
+                       const Color &color, const Point &pos) {
+  if (_isCreated) {
+    LOGERR("Warning, trying to create a GlyphText that was already created "
+           "with fontId: %" PRIu64, fontId);
+    return;
+  }
+
+  _atlas = gRsrcMgr->acquireGlyphAtlas(fontId, color);
+  if (nullptr == _atlas) {
+    LOGERR("Error, acquireGlyphAtlas() failed for fontId: %" PRIu64, fontId);
+    return;
+  }
+
+  _isCreated = true;
+  _pos = pos;
+  _textContent = text;
+  layoutGlyphs();
+}
+
+void GlyphText::destroy() {
+  if (!_isCreated) {
+    LOGERR("Warning, trying to destroy a not-created GlyphText");
+    return;
+  }
+
+  // sanity check, because manager could already been destroyed
+  if (nullptr != gRsrcMgr) {
+    gRsrcMgr->releaseGlyphAtlas(_atlas);
+  }
+
+  resetInternals();
+}
+
+void GlyphText::setText(const char *text) {
+  if (!_isCreated) {
+    LOGERR("Error, GlyphText not created!");
+    return;
+  }
+
+  if (_textContent == text) {
+    return;
+  }
+
+  _textContent = text;
+  layoutGlyphs();
+}
+
+void GlyphText::setColor(const Color &color) {
+  if (!_isCreated) {
+    LOGERR("Error, GlyphText not created!");
+    return;
+  }
+
+  if (color == _atlas->getColor()) {
+    return;
+  }
+
+  GlyphAtlas *newAtlas = gRsrcMgr->acquireGlyphAtlas(_atlas->getFontId(),
+                                                     color);
+  if (nullptr == newAtlas) {
+    LOGERR("Error, acquireGlyphAtlas() failed for fontId: %" PRIu64,
+           _atlas->getFontId());
+    return;
+  }
+
+  gRsrcMgr->releaseGlyphAtlas(_atlas);
+  _atlas = newAtlas;
+  layoutGlyphs();
+}
+
+void GlyphText::setPosition(const int32_t x, const int32_t y) {
+  const int32_t deltaX = x - _pos.x;
+  const int32_t deltaY = y - _pos.y;
+  _pos.x = x;
+  _pos.y = y;
+
+  for (DrawParams &glyph : _glyphs) {
+    glyph.pos.x += deltaX;
+    glyph.pos.y += deltaY;
+  }
+}
+
+void GlyphText::draw() const {
+  if (!_isCreated) {
+    LOGERR("Error, GlyphText not created!");
+    return;
+  }
+
+  if (!_isVisible) {
+    return;
+  }
+
+  for (const DrawParams &glyph : _glyphs) {
+    gDrawMgr->addDrawCmd(glyph);
+  }
+}
+
+void GlyphText::layoutGlyphs() {
+  _glyphs.clear();
+  _width = 0;
+  _height = _atlas->getLineHeight();
+
+  // every glyph is a sub-rectangle of the atlas texture
+  DrawParams glyphParams = _atlas->getDrawParams();
+  glyphParams.pos.y = _pos.y;
+  for (const char glyph : _textContent) {
+    const Rectangle &glyphRect = _atlas->getGlyphRect(glyph);
+    if (0 == glyphRect.w) {
+      continue;
+    }
+
+    glyphParams.frameRect = glyphRect;
+    glyphParams.pos.x = _pos.x + _width;
+    _width += glyphRect.w;
+
+    // the blank glyphs only advance the pen
+    if (' ' != glyph) {
+      _glyphs.push_back(glyphParams);
+    }
+  }
+}
+
+void GlyphText::resetInternals() {
+  _glyphs.clear();
+  _textContent.clear();
+  _atlas = nullptr;
+  _pos = Points::ZERO;
+  _width = 0;
+  _height = 0;
+  _isCreated = false;
+  _isVisible = true;
+}
@@ -12,21 +12,19 @@
 
 // Own components headers
 #include "manager_utils/managers/RsrcMgr.h"
-#include "manager_utils/drawing/Sprite.h"
 
-Image::Image() : _sprites(nullptr), _isDestroyed(false) {
+Image::Image() : _isDestroyed(false) {
   _drawParams.widgetType = WidgetType::IMAGE;
 }
 
-Image::Image(Image&& movedOther) : Widget(std::move(movedOther)) {
+Image::Image(Image&& movedOther)
+    : Widget(std::move(movedOther)), _sprite(std::move(movedOther._sprite)) {
   _drawParams.widgetType = WidgetType::IMAGE;
 
   // take ownership of resources
-  _sprites = movedOther._sprites;
   _isDestroyed = movedOther._isDestroyed;
 
   // ownership of resource should be taken from moved instance
-  movedOther._sprites = nullptr;
   movedOther._isDestroyed = false;
 }
 
@@ -36,14 +34,13 @@ Image& Image::operator=(Image&& movedOther) {
     _drawParams.widgetType = WidgetType::IMAGE;
 
     // take ownership of resources
-    _sprites = movedOther._sprites;
+    _sprite = std::move(movedOther._sprite);
     _isDestroyed = movedOther._isDestroyed;
 
     // explicitly invoke Widget's move assignment operator
     Widget::operator=(std::move(movedOther));
 
     // ownership of resource should be taken from moved instance
-    movedOther._sprites = nullptr;
     movedOther._isDestroyed = false;
   }
 
@@ -71,12 +68,6 @@ void Image::create(const uint64_t rsrcId) {
     return;
   }
 
-  _sprites = new Sprite();
-  if (nullptr == _sprites) {
-    LOGERR("Warning bad alloc for sprites for rsrcId: %" PRIu64, rsrcId);
-    return;
-  }
-
   _isCreated = true;
   _isDestroyed = false;
 
@@ -88,7 +79,7 @@ void Image::create(const uint64_t rsrcId) {
   _imageWidth = rsrcData->imageRect.w;
   _imageHeight = rsrcData->imageRect.h;
 
-  _sprites->init(rsrcId, rsrcData->spriteData);
+  _sprite.init(rsrcId, rsrcData->spriteData);
 
   /** Explicitly call setFrameRect() method in order to invoke any
    * crop modification (if such is enabled)
@@ -99,7 +90,7 @@ void Image::create(const uint64_t rsrcId) {
    *           single sprite in it with
    *           frameRect.x = 0 and frameRect.y = 0.
    * */
-  setFrameRect(_sprites->getFrameRect());
+  setFrameRect(_sprite.getFrameRect());
 }
 
 void Image::destroy() {
@@ -113,13 +104,7 @@ void Image::destroy() {
 
   Widget::reset();
 
-  if (_sprites)  // Sanity check
-  {
-    _sprites->deinit();
-
-    delete _sprites;
-    _sprites = nullptr;
-  }
+  _sprite.deinit();
 }
 
 void Image::setTexture(const uint64_t rsrcId) {
@@ -142,20 +127,10 @@ void Image::setTexture(const uint64_t rsrcId) {
     return;
   }
 
-  // sanity check
-  if (nullptr == _sprites) {
-    LOGERR(
-        "Logic error, sprites were not initialised for Image "
-        "with rsrcId: %" PRIu64,
-        _drawParams.rsrcId);
-
-    return;
-  }
-
   // remember the current frame before deinit
-  const int32_t CURR_FRAME = _sprites->getFrame();
+  const int32_t CURR_FRAME = _sprite.getFrame();
 
-  _sprites->deinit();
+  _sprite.deinit();
 
   // set Texture passes successfully
   _drawParams.rsrcId = rsrcId;
@@ -165,10 +140,10 @@ void Image::setTexture(const uint64_t rsrcId) {
   _imageHeight = rsrcData->imageRect.h;
 
   // initialise new resource sprites
-  _sprites->init(rsrcId, rsrcData->spriteData);
+  _sprite.init(rsrcId, rsrcData->spriteData);
 
   // set the old frame
-  _sprites->setFrame(CURR_FRAME);
+  _sprite.setFrame(CURR_FRAME);
 
   /** Explicitly call setFrameRect() method in order to invoke any
    * crop modification (if such is enabled)
@@ -179,38 +154,38 @@ void Image::setTexture(const uint64_t rsrcId) {
    *           single sprite in it with
    *           frameRect.x = 0 and frameRect.y = 0.
    * */
-  setFrameRect(_sprites->getFrameRect());
+  setFrameRect(_sprite.getFrameRect());
 }
 
 void Image::setFrame(const int32_t frameIndex) {
-  _sprites->setFrame(frameIndex);
+  _sprite.setFrame(frameIndex);
 
   /** Explicitly call setFrameRect() method in order to invoke any
    * crop modification (if such is enabled)
    * */
-  setFrameRect(_sprites->getFrameRect());
+  setFrameRect(_sprite.getFrameRect());
 }
 
 void Image::setNextFrame() {
-  _sprites->setNextFrame();
+  _sprite.setNextFrame();
 
   /** Explicitly call setFrameRect() method in order to invoke any
    * crop modification (if such is enabled)
    * */
-  setFrameRect(_sprites->getFrameRect());
+  setFrameRect(_sprite.getFrameRect());
 }
 
 void Image::setPrevFrame() {
-  _sprites->setPrevFrame();
+  _sprite.setPrevFrame();
 
   /** Explicitly call setFrameRect() method in order to invoke any
    * crop modification (if such is enabled)
    * */
-  setFrameRect(_sprites->getFrameRect());
+  setFrameRect(_sprite.getFrameRect());
 }
 
 void Image::addFrame(const Rectangle& rectFrame) {
-  _sprites->addFrame(rectFrame);
+  _sprite.addFrame(rectFrame);
 }
 
 void Image::setManualFrames(const Rectangle* frameRects,
@@ -218,35 +193,23 @@ void Image::setManualFrames(const Rectangle* frameRects,
   if (!_isCreated) {
     LOGERR("Error, Image with rsrcId: %" PRIu64" already created. "
            "::setManualFrames() will take no effect",
-           _sprites->getFramesRsrcId());
+           _sprite.getFramesRsrcId());
     return;
   }
 
-  /** choosing to pay the price of the overhead to recreate the vector
-   * here, because:
-   *  1) it will be awful to include <vector> header into the header
-   *     of the Image class (used all across the code base)
-   *  2) this method should be almost to none called
-   * */
-  std::vector<Rectangle> rects;
-  rects.reserve(rectanglesCount);
-
-  for (uint32_t i = 0; i < rectanglesCount; ++i) {
-    rects.emplace_back(frameRects[i]);
-  }
-
-  const uint64_t currRsrcId = _sprites->getFramesRsrcId();
+  // manual frames are private for the Image -> the sprite makes its own copy
+  const uint64_t currRsrcId = _sprite.getFramesRsrcId();
 
-  _sprites->deinit();
-  _sprites->init(currRsrcId, rects);
+  _sprite.deinit();
+  _sprite.init(currRsrcId, frameRects, rectanglesCount);
 }
 
 int32_t Image::getFrame() const {
-  return _sprites->getFrame();
+  return _sprite.getFrame();
 }
 
 int32_t Image::getFrameCount() const {
-  return _sprites->getFrameCount();
+  return _sprite.getFrameCount();
 }
 
 
@@ -2,7 +2,7 @@
 #include "manager_utils/drawing/NumberCounter.h"
 
 // System headers
-#include <string>
+#include <cinttypes>
 
 // Other libraries headers
 #include "utils/data_type/EnumClassUtils.h"
@@ -13,10 +13,16 @@
 
 // Own components headers
 
+namespace {
+// 20 digits for UINT64_MAX + 6 group separators + terminator
+constexpr int32_t MAX_VALUE_CHARS = 32;
+}
+
 NumberCounter::NumberCounter()
     : _timerPeriod(INIT_UINT8_VALUE), _currentValue(INIT_UINT64_VALUE),
       _increaseTimerId(0), _decreaseTimerId(0), _firstGear(INIT_UINT64_VALUE),
-      _step(INIT_UINT64_VALUE), _final(INIT_UINT64_VALUE) {
+      _step(INIT_UINT64_VALUE), _final(INIT_UINT64_VALUE),
+      _renderMode(NumberCounterRenderMode::TEXT), _thousandsSeparator('\0') {
 
 }
 
@@ -31,9 +37,28 @@ ErrorCode NumberCounter::init(const NumberCounterConfig &cfg) {
   // set start value
   _currentValue = cfg.startValue;
 
-  // create balance field with text 0
-  _balanceText.create(cfg.fontId, std::to_string(_currentValue).c_str(),
-      cfg.fontColor);
+  _renderMode = cfg.renderMode;
+  _thousandsSeparator = cfg.thousandsSeparator;
+
+  char valueStr[MAX_VALUE_CHARS];
+  formatValue(valueStr);
+
+  // create balance field with the start value
+  if (NumberCounterRenderMode::DIGIT_STRIP == _renderMode) {
+    _balanceGlyphText.create(cfg.fontId, valueStr, cfg.fontColor);
+    if (!_balanceGlyphText.isCreated()) {
+      LOGERR("Error, GlyphText could not be created for fontId: %" PRIu64,
+             cfg.fontId);
+      return ErrorCode::FAILURE;
+    }
+  }
+
+  // always created, because derived classes operate on it directly.
+  // It is kept hidden (and never updated) in DIGIT_STRIP mode
+  _balanceText.create(cfg.fontId, valueStr, cfg.fontColor);
+  if (NumberCounterRenderMode::DIGIT_STRIP == _renderMode) {
+    _balanceText.hide();
+  }
 
   setAmountText();
 
@@ -51,17 +76,56 @@ ErrorCode NumberCounter::init(const NumberCounterConfig &cfg) {
 }
 
 void NumberCounter::setAmountText() {
+  char valueStr[MAX_VALUE_CHARS];
+  formatValue(valueStr);
+
+  if (NumberCounterRenderMode::DIGIT_STRIP == _renderMode) {
+    // no rasterization - only the glyph rectangles are changed
+    _balanceGlyphText.setText(valueStr);
+  } else {
+    _balanceText.setText(valueStr);
+  }
+
   // calculate position for balance field
-  _balanceText.setText(std::to_string(_currentValue).c_str());
   setTextPosition();
 }
 
+void NumberCounter::formatValue(char *outBuffer) const {
+  // fill the digits backwards from the end of a local buffer
+  char digits[MAX_VALUE_CHARS];
+  int32_t idx = MAX_VALUE_CHARS - 1;
+  digits[idx] = '\0';
+
+  uint64_t value = _currentValue;
+  int32_t digitsInGroup = 0;
+  do {
+    if ( ('\0' != _thousandsSeparator) && (3 == digitsInGroup)) {
+      digits[--idx] = _thousandsSeparator;
+      digitsInGroup = 0;
+    }
+
+    digits[--idx] = static_cast<char>('0' + (value % 10));
+    value /= 10;
+    ++digitsInGroup;
+  } while (0 != value);
+
+  int32_t outIdx = 0;
+  while (MAX_VALUE_CHARS > idx) {
+    outBuffer[outIdx++] = digits[idx++];
+  }
+}
+
 void NumberCounter::draw() const {
   // if balance field use own background draw it
   if (_balanceBackground.isCreated()) {
     _balanceBackground.draw();
   }
-  _balanceText.draw();
+
+  if (NumberCounterRenderMode::DIGIT_STRIP == _renderMode) {
+    _balanceGlyphText.draw();
+  } else {
+    _balanceText.draw();
+  }
 }
 
 void NumberCounter::update(const uint64_t newValue, NumberCounterSpeed speed) {
@@ -121,25 +185,27 @@ void NumberCounter::decreaseWith(const uint64_t amount,
 }
 
 void NumberCounter::calculateStep() {
-  // difference between current and final value
-  const int64_t diff = _currentValue - _final;
+  // absolute difference between current and final value
+  const bool isIncreasing = _currentValue < _final;
+  const uint64_t diff =
+      isIncreasing ? (_final - _currentValue) : (_currentValue - _final);
 
   // step is a 4% difference
-  _step = static_cast<uint64_t>(std::abs(diff / 25));
+  _step = diff / 25;
 
   // min step is 1
   _step = _step ? _step : 1;
 
-  // if difference is less then 0 -> new value is bigger then old
-  if (diff < 0) {
+  // new value is bigger then old
+  if (isIncreasing) {
     // calculate value to change speed
     _firstGear = (_step * 24) + _currentValue;
 
     // start increase process
     increase();
   }
-  // if difference is bigger then 0 -> new value is less then old
-  else if (diff > 0) {
+  // new value is less then old
+  else if (0 != diff) {
     // calculate value to change speed
     _firstGear = _currentValue - (_step * 24);
 
@@ -152,6 +218,14 @@ void NumberCounter::setTextPosition() {
   int32_t currentWidth = 0;
   int32_t currentHeight = 0;
 
+  if (NumberCounterRenderMode::DIGIT_STRIP == _renderMode) {
+    const auto centeredPos = WidgetAligner::getPosition(
+        _balanceGlyphText.getWidth(), _balanceGlyphText.getHeight(),
+        _boundaryRect, WidgetAlignment::CENTER_CENTER);
+    _balanceGlyphText.setPosition(centeredPos);
+    return;
+  }
+
   if (_balanceText.isScalingActive()) {
     currentWidth = _balanceText.getScaledWidth();
     currentHeight = _balanceText.getScaledHeight();
@@ -290,10 +364,22 @@ uint64_t NumberCounter::getEndValue() const {
 }
 
 void NumberCounter::activateTextScaling() {
+  if (NumberCounterRenderMode::DIGIT_STRIP == _renderMode) {
+    LOGERR("Error, text scaling is not supported for "
+           "NumberCounterRenderMode::DIGIT_STRIP");
+    return;
+  }
+
   _balanceText.activateScaling();
 }
 
 void NumberCounter::setTextMaxScalingWidth(const int32_t maxWidth) {
+  if (NumberCounterRenderMode::DIGIT_STRIP == _renderMode) {
+    LOGERR("Error, text scaling is not supported for "
+           "NumberCounterRenderMode::DIGIT_STRIP");
+    return;
+  }
+
   _balanceText.setMaxScalingWidth(maxWidth);
 }
 
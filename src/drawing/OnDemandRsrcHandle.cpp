@@ -0,0 +1,64 @@
+// Corresponding header
+#include "manager_utils/drawing/OnDemandRsrcHandle.h"
+
+// System headers
+
+// Other libraries headers
+
+// Own components headers
+#include "manager_utils/managers/RsrcMgr.h"
+
+OnDemandRsrcHandle::OnDemandRsrcHandle() : _rsrcId(0), _isValid(false) {
+}
+
+OnDemandRsrcHandle::~OnDemandRsrcHandle() noexcept {
+  release();
+}
+
+OnDemandRsrcHandle::OnDemandRsrcHandle(OnDemandRsrcHandle&& movedOther) noexcept
+    : _rsrcId(movedOther._rsrcId), _isValid(movedOther._isValid) {
+  movedOther._isValid = false;
+}
+
+OnDemandRsrcHandle& OnDemandRsrcHandle::operator=(
+    OnDemandRsrcHandle&& movedOther) noexcept {
+  // check for self-assignment
+  if (this != &movedOther) {
+    release();
+
+    _rsrcId = movedOther._rsrcId;
+    _isValid = movedOther._isValid;
+    movedOther._isValid = false;
+  }
+
+  return *this;
+}
+
+void OnDemandRsrcHandle::acquire(const uint64_t rsrcId) {
+  // acquire first, so re-acquiring the same resource does not
+  // drop it to the eviction cache in between
+  gRsrcMgr->loadResourceOnDemandSingle(rsrcId);
+  release();
+
+  _rsrcId = rsrcId;
+  _isValid = true;
+}
+
+void OnDemandRsrcHandle::adopt(const uint64_t rsrcId) {
+  release();
+
+  _rsrcId = rsrcId;
+  _isValid = true;
+}
+
+void OnDemandRsrcHandle::release() {
+  if (!_isValid) {
+    return;
+  }
+  _isValid = false;
+
+  // sanity check, because manager could already been destroyed
+  if (nullptr != gRsrcMgr) {
+    gRsrcMgr->unloadResourceOnDemandSingle(_rsrcId);
+  }
+}
@@ -9,24 +9,63 @@
 // Own components headers
 
 Sprite::Sprite()
-    : _currFrame(0), _maxFrames(0), _rsrcId(0) {
+    : _frames(nullptr), _currFrame(0), _maxFrames(0), _rsrcId(0) {
 }
 
 Sprite::~Sprite() noexcept {
   deinit();
 }
 
+Sprite::Sprite(Sprite&& movedOther)
+    : _frames(movedOther._frames),
+      _ownedFrames(std::move(movedOther._ownedFrames)),
+      _currFrame(movedOther._currFrame), _maxFrames(movedOther._maxFrames),
+      _rsrcId(movedOther._rsrcId) {
+  // the moved vector keeps its buffer, but re-point explicitly for clarity
+  if (!_ownedFrames.empty()) {
+    _frames = _ownedFrames.data();
+  }
+
+  movedOther.deinit();
+}
+
+Sprite& Sprite::operator=(Sprite&& movedOther) {
+  // check for self-assignment
+  if (this != &movedOther) {
+    _ownedFrames = std::move(movedOther._ownedFrames);
+    _frames = _ownedFrames.empty() ? movedOther._frames : _ownedFrames.data();
+    _currFrame = movedOther._currFrame;
+    _maxFrames = movedOther._maxFrames;
+    _rsrcId = movedOther._rsrcId;
+
+    movedOther.deinit();
+  }
+
+  return *this;
+}
+
 void Sprite::init(const uint64_t rsrcId,
                   const std::vector<Rectangle> &spriteData) {
+  _ownedFrames.clear();
+  _frames = spriteData.data();
   _maxFrames = static_cast<int32_t>(spriteData.size());
-  _spriteData = spriteData;
+  _rsrcId = rsrcId;
+}
+
+void Sprite::init(const uint64_t rsrcId, const Rectangle *frameRects,
+                  const uint32_t rectanglesCount) {
+  _ownedFrames.assign(frameRects, frameRects + rectanglesCount);
+  _frames = _ownedFrames.data();
+  _maxFrames = static_cast<int32_t>(rectanglesCount);
   _rsrcId = rsrcId;
 }
 
 void Sprite::deinit() {
+  _frames = nullptr;
+  _ownedFrames.clear();
   _currFrame = 0;
+  _maxFrames = 0;
   _rsrcId = 0;
-  _spriteData.clear();
 }
 
 void Sprite::setFrame(const int32_t frameIndex) {
@@ -52,7 +91,13 @@ void Sprite::setPrevFrame() {
 }
 
 void Sprite::addFrame(const Rectangle &frameRect) {
+  if (_ownedFrames.empty()) {
+    // copy on write - detach from the shared frame table
+    _ownedFrames.reserve(static_cast<size_t>(_maxFrames) + 1);
+    _ownedFrames.assign(_frames, _frames + _maxFrames);
+  }
+
+  _ownedFrames.emplace_back(frameRect);
+  _frames = _ownedFrames.data();
   ++_maxFrames;
-  _spriteData.emplace_back(frameRect);
 }
-
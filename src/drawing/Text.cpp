@@ -2,7 +2,6 @@
 #include "manager_utils/drawing/Text.h"
 
 // System headers
-#include <cstring>
 #include <utility>
 
 // Other libraries headers
@@ -11,12 +10,13 @@
 #include "utils/log/Log.h"
 
 // Own components headers
+#include "manager_utils/managers/DrawMgr.h"
 #include "manager_utils/managers/RsrcMgr.h"
 
 Text::Text()
-    : _textContent(nullptr),
-      _fontId(INIT_UINT64_VALUE),
+    : _fontId(INIT_UINT64_VALUE),
       _color(Colors::BLACK),
+      _asyncTicket(0),
       _isDestroyed(false){
   _drawParams.widgetType = WidgetType::TEXT;
 }
@@ -29,9 +29,10 @@ Text::Text(Text&& movedOther)
   _drawParams.widgetType = WidgetType::TEXT;
 
   // take ownership of resources
-  _textContent = movedOther._textContent;
+  _textContent = std::move(movedOther._textContent);
   _fontId = movedOther._fontId;
   _color = movedOther._color;
+  _asyncTicket = movedOther._asyncTicket;
   _isDestroyed = movedOther._isDestroyed;
 
   // ownership of resource should be taken from moved instance
@@ -44,9 +45,10 @@ Text& Text::operator=(Text&& movedOther) {
     _drawParams.widgetType = WidgetType::TEXT;
 
     // take ownership of resources
-    _textContent = movedOther._textContent;
+    _textContent = std::move(movedOther._textContent);
     _fontId = movedOther._fontId;
     _color = movedOther._color;
+    _asyncTicket = movedOther._asyncTicket;
     _isDestroyed = movedOther._isDestroyed;
 
     // explicitly invoke Widget's move assignment operator
@@ -63,6 +65,8 @@ Text::~Text() noexcept {
   // attempt to destroy text only if it's was first created and not destroyed
   if (true == _isCreated && false == _isDestroyed) {
     destroy();
+  } else {
+    cancelAsyncRequest();
   }
 }
 
@@ -91,7 +95,7 @@ void Text::create(const uint64_t fontId,
   }
 
   //copy text after successful creation
-  copyTextContent(text);
+  _textContent.assign(text);
 
   /** Explicitly call setFrameRect() method in order to invoke any
    * crop modification (if such is enabled).
@@ -115,6 +119,14 @@ void Text::destroy() {
   }
 
   if (!_isCreated) {
+    if (isAsyncRequestPending()) {
+      // ::createAsync() is still in progress -> drop its result
+      cancelAsyncRequest();
+      resetInternals();
+      Widget::reset();
+      return;
+    }
+
     LOGERR(
         "Warning, trying to destroy a not-created text with fontId: "
         "%" PRIu64, _fontId);
@@ -123,17 +135,21 @@ void Text::destroy() {
 
   _isDestroyed = true;
 
+  cancelAsyncRequest();
+
   // sanity check, because manager could already been destroyed
   if (nullptr != gRsrcMgr) {
     // unload text from graphical text vector
     gRsrcMgr->unloadText(_drawParams.textId);
   }
 
-  if (nullptr != _textContent) {
-    delete[] _textContent;
-    _textContent = nullptr;
+  if (nullptr != gDrawMgr) {
+    gDrawMgr->onTextureDestroyed(WidgetType::TEXT,
+        static_cast<uint64_t>(_drawParams.textId));
   }
 
+  _textContent.clear();
+
   Widget::reset();
 }
 
@@ -148,20 +164,24 @@ void Text::setText(const char* text) {
    *  avoid unnecessary overhead.
    * */
 
-  // compare strings only if their size is equal
-  if (strlen(_textContent) == strlen(text)) {
-    if (0 == strcmp(_textContent, text)) {
-      // strings are equal -> no need to re-create the text texture
-      return;
-    }
+  // single pass over the input. The contents are compared only if both
+  // their lengths and hashes are equal
+  size_t textLength = 0;
+  const uint64_t textHash = TextContent::computeHash(text, textLength);
+  if (_textContent.equals(text, textLength, textHash)) {
+    // strings are equal -> no need to re-create the text texture
+    return;
   }
 
-  copyTextContent(text);
+  cancelAsyncRequest();
+  _textContent.assign(text, textLength, textHash);
 
   // setting new text required freeing old resources, allocating new ones
   // and creating new surface/textures
-  gRsrcMgr->reloadText(_fontId, _textContent, _color,
+  gRsrcMgr->reloadText(_fontId, _textContent.c_str(), _color,
                        _drawParams.textId, _imageWidth, _imageHeight);
+  gDrawMgr->onTextureRecreated(WidgetType::TEXT,
+      static_cast<uint64_t>(_drawParams.textId));
 
   /** Explicitly call setFrameRect() method in order to invoke any
    * crop modification (if such is enabled).
@@ -182,11 +202,14 @@ void Text::setColor(const Color& color) {
     return;
   }
 
+  cancelAsyncRequest();
   _color = color;
   // setting new text required freeing old resources, allocating new ones
   // and creating new surface/textures
-  gRsrcMgr->reloadText(_fontId, _textContent, _color,
+  gRsrcMgr->reloadText(_fontId, _textContent.c_str(), _color,
                        _drawParams.textId, _imageWidth, _imageHeight);
+  gDrawMgr->onTextureRecreated(WidgetType::TEXT,
+      static_cast<uint64_t>(_drawParams.textId));
 
   /** Explicitly call setFrameRect() method in order to invoke any
    * crop modification (if such is enabled).
@@ -207,13 +230,16 @@ void Text::setTextAndColor(const char* text, const Color& color) {
     return;
   }
 
-  copyTextContent(text);
+  cancelAsyncRequest();
+  _textContent.assign(text);
 
   _color = color;
   // setting new text required freeing old resources, allocating new ones
   // and creating new surface/textures
-  gRsrcMgr->reloadText(_fontId, _textContent, _color,
+  gRsrcMgr->reloadText(_fontId, _textContent.c_str(), _color,
                        _drawParams.textId, _imageWidth, _imageHeight);
+  gDrawMgr->onTextureRecreated(WidgetType::TEXT,
+      static_cast<uint64_t>(_drawParams.textId));
 
   /** Explicitly call setFrameRect() method in order to invoke any
    * crop modification (if such is enabled).
@@ -228,26 +254,159 @@ void Text::setTextAndColor(const char* text, const Color& color) {
                          _imageHeight));  // frameRect.
 }
 
-void Text::copyTextContent(const char* text) {
-  const size_t INPUT_TEXT_SIZE = strlen(text);
+void Text::createAsync(const uint64_t fontId,
+                       const char* text,
+                       const Color& color,
+                       const Point& pos) {
+  if (_isCreated || isAsyncRequestPending()) {
+    LOGERR("Warning, trying to create a text that was already created with "
+          "fontId: %" PRIu64, _fontId);
+    return;
+  }
+
+  _isDestroyed = false;
+  _fontId = fontId;
+  _color = color;
+  _drawParams.pos.x = pos.x;
+  _drawParams.pos.y = pos.y;
+  _textContent.assign(text);
+
+  // the Text is marked as created once the rasterization is completed
+  _asyncTicket =
+      gRsrcMgr->loadTextAsync(_fontId, _textContent.c_str(), _color);
+}
+
+void Text::setTextAsync(const char* text) {
+  if (!_isCreated) {
+    LOGERR("Error, text with fontId: %" PRIu64" not created!", _fontId);
+    return;
+  }
+
+  size_t textLength = 0;
+  const uint64_t textHash = TextContent::computeHash(text, textLength);
+  if (_textContent.equals(text, textLength, textHash)) {
+    // the current (or the pending) content is the same
+    return;
+  }
+
+  cancelAsyncRequest();
+  _textContent.assign(text, textLength, textHash);
+  _asyncTicket =
+      gRsrcMgr->loadTextAsync(_fontId, _textContent.c_str(), _color);
+}
+
+void Text::setColorAsync(const Color& color) {
+  if (!_isCreated) {
+    LOGERR("Error, text with fontId: %" PRIu64" not created!", _fontId);
+    return;
+  }
+
+  cancelAsyncRequest();
+  _color = color;
+  _asyncTicket =
+      gRsrcMgr->loadTextAsync(_fontId, _textContent.c_str(), _color);
+}
+
+void Text::setTextAndColorAsync(const char* text, const Color& color) {
+  if (!_isCreated) {
+    LOGERR("Error, text with fontId: %" PRIu64" not created!", _fontId);
+    return;
+  }
+
+  cancelAsyncRequest();
+  _textContent.assign(text);
+  _color = color;
+  _asyncTicket =
+      gRsrcMgr->loadTextAsync(_fontId, _textContent.c_str(), _color);
+}
+
+void Text::process() {
+  if (!isAsyncRequestPending()) {
+    return;
+  }
+
+  AsyncTextResult result;
+  if (!gRsrcMgr->pollTextAsync(_asyncTicket, result)) {
+    return; //not ready yet
+  }
+  _asyncTicket = 0;
+
+  if (ErrorCode::SUCCESS != result.errCode) {
+    LOGERR("Error, async text rasterization failed for fontId: %" PRIu64,
+           _fontId);
+    if (!_isCreated) {
+      resetInternals();
+    }
+    return;
+  }
+
+  _imageWidth = result.width;
+  _imageHeight = result.height;
+
+  if (!_isCreated) {
+    _isCreated = true;
+    _drawParams.textId = result.textId;
+    updateFrameRect();
+    return;
+  }
+
+  // the previous texture is shown until now -> swap it for the new one
+  const int32_t oldTextId = _drawParams.textId;
+  _drawParams.textId = result.textId;
+  gRsrcMgr->unloadText(oldTextId);
+  gDrawMgr->onTextureDestroyed(WidgetType::TEXT,
+      static_cast<uint64_t>(oldTextId));
+  gDrawMgr->onTextureRecreated(WidgetType::TEXT,
+      static_cast<uint64_t>(_drawParams.textId));
+
+  // the new texture does not carry the alpha modulation state
+  if (_isAlphaModulationEnabled) {
+    gRsrcMgr->makeTextUnique(_drawParams.textId);
+    gDrawMgr->onTextureRecreated(WidgetType::TEXT,
+        static_cast<uint64_t>(_drawParams.textId));
+    gDrawMgr->changeTextureBlendMode(WidgetType::TEXT,
+        static_cast<uint64_t>(_drawParams.textId), BlendMode::BLEND);
+    gDrawMgr->changeTextureOpacity(WidgetType::TEXT,
+        static_cast<uint64_t>(_drawParams.textId), _drawParams.opacity);
+  }
 
-  // sanity check
-  if (nullptr != _textContent) {
-    delete[] _textContent;  // free current buffer
-    _textContent = nullptr;
+  updateFrameRect();
+}
+
+void Text::draw() const {
+  // a text with pending ::createAsync() has nothing to draw yet
+  if (!_isCreated && isAsyncRequestPending()) {
+    return;
   }
 
-  char* tempText = new char[INPUT_TEXT_SIZE + 1];  //+1 for the terminator
-  memcpy(tempText, text, INPUT_TEXT_SIZE);
+  Widget::draw();
+}
 
-  // strncpy should be OK, but just to be sure
-  tempText[INPUT_TEXT_SIZE] = '\0';
+void Text::cancelAsyncRequest() {
+  if (!isAsyncRequestPending()) {
+    return;
+  }
+
+  // sanity check, because manager could already been destroyed
+  if (nullptr != gRsrcMgr) {
+    gRsrcMgr->cancelTextAsync(_asyncTicket);
+  }
+  _asyncTicket = 0;
+}
 
-  _textContent = tempText;
+void Text::updateFrameRect() {
+  /** Explicitly call setFrameRect() method in order to invoke any
+   * crop modification (if such is enabled).
+   * */
+  setFrameRect(Rectangle(0,               // frameRect.x
+                         0,               // frameRect.y
+                         _imageWidth,     // frameRect.w
+                         _imageHeight));  // frameRect.h
 }
 
 void Text::resetInternals() {
-  _textContent = nullptr;
+  _textContent.clear();
+  _asyncTicket = 0;
   _fontId = INIT_UINT64_VALUE;
   _color = Colors::BLACK;
   _isDestroyed = false;
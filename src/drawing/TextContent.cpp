@@ -0,0 +1,147 @@
+// Corresponding header
+#include "manager_utils/drawing/TextContent.h"
+
+// System headers
+#include <cstring>
+#include <utility>
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "manager_utils/memory/WidgetAllocator.h"
+
+namespace {
+constexpr uint64_t FNV_OFFSET_BASIS = 14695981039346656037ULL;
+constexpr uint64_t FNV_PRIME = 1099511628211ULL;
+}
+
+TextContent::TextContent()
+    : _data(_inlineBuffer),
+      _capacity(INLINE_CAPACITY),
+      _length(0),
+      _hash(FNV_OFFSET_BASIS) {
+  _inlineBuffer[0] = '\0';
+}
+
+TextContent::~TextContent() noexcept {
+  releaseHeapBuffer();
+}
+
+TextContent::TextContent(TextContent&& movedOther) noexcept
+    : TextContent() {
+  *this = std::move(movedOther);
+}
+
+TextContent& TextContent::operator=(TextContent&& movedOther) noexcept {
+  // check for self-assignment
+  if (this == &movedOther) {
+    return *this;
+  }
+
+  releaseHeapBuffer();
+
+  if (movedOther.isInline()) {
+    memcpy(_inlineBuffer, movedOther._inlineBuffer, movedOther._length + 1);
+    _data = _inlineBuffer;
+    _capacity = INLINE_CAPACITY;
+  } else {
+    // take ownership of the heap buffer
+    _data = movedOther._data;
+    _capacity = movedOther._capacity;
+  }
+  _length = movedOther._length;
+  _hash = movedOther._hash;
+
+  movedOther._data = movedOther._inlineBuffer;
+  movedOther._capacity = INLINE_CAPACITY;
+  movedOther._inlineBuffer[0] = '\0';
+  movedOther._length = 0;
+  movedOther._hash = FNV_OFFSET_BASIS;
+
+  return *this;
+}
+
+uint64_t TextContent::computeHash(const char* text, size_t& outLength) {
+  // FNV-1a
+  uint64_t hash = FNV_OFFSET_BASIS;
+  const char* iter = text;
+  for (; '\0' != *iter; ++iter) {
+    hash ^= static_cast<uint8_t>(*iter);
+    hash *= FNV_PRIME;
+  }
+
+  outLength = static_cast<size_t>(iter - text);
+  return hash;
+}
+
+void TextContent::assign(const char* text) {
+  size_t length = 0;
+  const uint64_t hash = computeHash(text, length);
+  assign(text, length, hash);
+}
+
+void TextContent::assign(const char* text, const size_t length,
+                         const uint64_t hash) {
+  // reuse the current buffer if the new content fits in it
+  // (memmove, because the input text could be the current content)
+  if (length < _capacity) {
+    memmove(_data, text, length);
+    _data[length] = '\0';
+    _length = length;
+    _hash = hash;
+    return;
+  }
+
+  //+1 for the terminator
+  char* newData = static_cast<char*>(WidgetAllocator::allocate(length + 1));
+  if (nullptr == newData) {
+    LOGERR("Error, bad alloc for text content with size: %zu", length);
+    return;
+  }
+  memcpy(newData, text, length);
+  newData[length] = '\0';
+
+  // free the current buffer only after the copy (the input text could be
+  // the current content)
+  releaseHeapBuffer();
+  _data = newData;
+  _capacity = WidgetAllocator::getUsableSize(newData);
+  _length = length;
+  _hash = hash;
+}
+
+bool TextContent::equals(const char* text, const size_t length,
+                         const uint64_t hash) const {
+  if ( (length != _length) || (hash != _hash)) {
+    return false;
+  }
+
+  // guard against hash collisions
+  return 0 == memcmp(_data, text, length);
+}
+
+bool TextContent::equals(const char* text) const {
+  size_t length = 0;
+  const uint64_t hash = computeHash(text, length);
+  return equals(text, length, hash);
+}
+
+bool TextContent::equals(const TextContent& other) const {
+  return equals(other._data, other._length, other._hash);
+}
+
+void TextContent::clear() {
+  releaseHeapBuffer();
+  _data = _inlineBuffer;
+  _capacity = INLINE_CAPACITY;
+  _inlineBuffer[0] = '\0';
+  _length = 0;
+  _hash = FNV_OFFSET_BASIS;
+}
+
+void TextContent::releaseHeapBuffer() {
+  if (!isInline()) {
+    WidgetAllocator::deallocate(_data);
+  }
+}
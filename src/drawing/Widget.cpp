@@ -2,7 +2,6 @@
 #include "manager_utils/drawing/Widget.h"
 
 // System headers
-#include <cstring>
 
 // Other libraries headers
 #include "sdl_utils/drawing/GeometryUtils.h"
@@ -12,6 +11,8 @@
 
 // Own components headers
 #include "manager_utils/managers/DrawMgr.h"
+#include "manager_utils/managers/RsrcMgr.h"
+#include "manager_utils/trace/Tracer.h"
 
 namespace {
 constexpr auto MAX_SCALE_FACTOR_INTERNAL = MAX_SCALE_FACTOR + 0.01;
@@ -76,6 +77,7 @@ Widget &Widget::operator=(Widget &&movedOther) {
 }
 
 void Widget::draw() const {
+  const TraceZone zone("Widget::draw");
   if (!_isCreated) {
     LOGERR(
         "Error, widget with rsrcId: %" PRIu64" not created!", _drawParams.rsrcId);
@@ -114,35 +116,21 @@ void Widget::activateAlphaModulation() {
 
   _isAlphaModulationEnabled = true;
 
-  const BlendMode blendMode = BlendMode::BLEND;
-
-  // NOTE: for third parameter either rsrcId(uint64_t) or
-  //      uniqueContainerId(int32_t) so the bigger size is chosen
-  //      for the buffer population
-  uint8_t data[sizeof(_drawParams.widgetType) + sizeof(blendMode) +
-               sizeof(_drawParams.rsrcId)];
-  uint64_t populatedBytes = 0;
-
-  memcpy(data, &_drawParams.widgetType, sizeof(_drawParams.widgetType));
-  populatedBytes += sizeof(_drawParams.widgetType);
-
-  memcpy(data + populatedBytes, &blendMode, sizeof(blendMode));
-  populatedBytes += sizeof(blendMode);
-
-  if (WidgetType::IMAGE == _drawParams.widgetType) {
-    memcpy(data + populatedBytes, &_drawParams.rsrcId,
-           sizeof(_drawParams.rsrcId));
-    populatedBytes += sizeof(_drawParams.rsrcId);
-  } else  // WidgetType::TEXT or WidgetType::SPRITE_BUFFER
-  {
-    //textId and and spriteBufferId are the same since they are in a union
-    memcpy(data + populatedBytes, &_drawParams.textId,
-           sizeof(_drawParams.textId));
-    populatedBytes += sizeof(_drawParams.textId);
+  // identical texts share a texture -> the blend mode and the opacity of
+  // an alpha modulated text must not affect the others
+  if (WidgetType::TEXT == _drawParams.widgetType) {
+    gRsrcMgr->makeTextUnique(_drawParams.textId);
+    gDrawMgr->onTextureRecreated(WidgetType::TEXT,
+        static_cast<uint64_t>(_drawParams.textId));
   }
 
-  gDrawMgr->addRendererCmd(RendererCmd::CHANGE_TEXTURE_BLENDMODE, data,
-                           populatedBytes);
+  // texts and sprite buffers are identified by their textId/spriteBufferId
+  // (they are the same since they are in a union)
+  const uint64_t containerId = (WidgetType::IMAGE == _drawParams.widgetType) ?
+      _drawParams.rsrcId : static_cast<uint64_t>(_drawParams.textId);
+
+  gDrawMgr->changeTextureBlendMode(_drawParams.widgetType, containerId,
+                                   BlendMode::BLEND);
 }
 
 void Widget::deactivateAlphaModulation() {
@@ -157,35 +145,13 @@ void Widget::deactivateAlphaModulation() {
 
   _isAlphaModulationEnabled = false;
 
-  const BlendMode blendMode = BlendMode::NONE;
-
-  // NOTE: for third parameter either rsrcId(uint64_t) or
-  //      uniqueContainerId(int32_t) so the bigger size is chosen
-  //      for the buffer population
-  uint8_t data[sizeof(_drawParams.widgetType) + sizeof(blendMode) +
-               sizeof(_drawParams.rsrcId)];
-  uint64_t populatedBytes = 0;
-
-  memcpy(data, &_drawParams.widgetType, sizeof(_drawParams.widgetType));
-  populatedBytes += sizeof(_drawParams.widgetType);
+  // texts and sprite buffers are identified by their textId/spriteBufferId
+  // (they are the same since they are in a union)
+  const uint64_t containerId = (WidgetType::IMAGE == _drawParams.widgetType) ?
+      _drawParams.rsrcId : static_cast<uint64_t>(_drawParams.textId);
 
-  memcpy(data + populatedBytes, &blendMode, sizeof(blendMode));
-  populatedBytes += sizeof(blendMode);
-
-  if (WidgetType::IMAGE == _drawParams.widgetType) {
-    memcpy(data + populatedBytes, &_drawParams.rsrcId,
-           sizeof(_drawParams.rsrcId));
-    populatedBytes += sizeof(_drawParams.rsrcId);
-  } else  // WidgetType::TEXT or WidgetType::SPRITE_BUFFER
-  {
-    //textId and and spriteBufferId are the same since they are in a union
-    memcpy(data + populatedBytes, &_drawParams.textId,
-           sizeof(_drawParams.textId));
-    populatedBytes += sizeof(_drawParams.textId);
-  }
-
-  gDrawMgr->addRendererCmd(RendererCmd::CHANGE_TEXTURE_BLENDMODE, data,
-                           populatedBytes);
+  gDrawMgr->changeTextureBlendMode(_drawParams.widgetType, containerId,
+                                   BlendMode::NONE);
 }
 
 void Widget::activateScaling() {
@@ -671,22 +637,8 @@ void Widget::setOpacity(const int32_t opacity) {
   }
 
   //textId and and spriteBufferId are the same since they are in a union
-  uint8_t data[sizeof(_drawParams.widgetType) + sizeof(opacity) +
-               sizeof(_drawParams.textId)];
-  uint64_t populatedBytes = 0;
-
-  memcpy(data, &_drawParams.widgetType, sizeof(_drawParams.widgetType));
-  populatedBytes += sizeof(_drawParams.widgetType);
-
-  memcpy(data + populatedBytes, &opacity, sizeof(opacity));
-  populatedBytes += sizeof(opacity);
-
-  memcpy(data + populatedBytes, &_drawParams.textId,
-         sizeof(_drawParams.textId));
-  populatedBytes += sizeof(_drawParams.textId);
-
-  gDrawMgr->addRendererCmd(RendererCmd::CHANGE_TEXTURE_OPACITY, data,
-                           populatedBytes);
+  gDrawMgr->changeTextureOpacity(_drawParams.widgetType,
+      static_cast<uint64_t>(_drawParams.textId), opacity);
 }
 
 void Widget::rotate(const double angle) {
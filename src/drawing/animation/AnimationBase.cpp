@@ -10,6 +10,7 @@
 
 // Own components headers
 #include "manager_utils/drawing/Fbo.h"
+#include "manager_utils/memory/WidgetAllocator.h"
 #include "utils/LimitValues.h"
 
 AnimationBase::AnimationBase()
@@ -17,10 +18,8 @@ AnimationBase::AnimationBase()
 
 AnimationBase::~AnimationBase() noexcept {
   if (AnimImageType::INTERNAL == _cfg.animImageType) {
-    if (nullptr != _img) {
-      delete _img;
-      _img = nullptr;
-    }
+    WidgetAllocator::destroy(_img);
+    _img = nullptr;
   }
 }
 
@@ -72,7 +71,12 @@ ErrorCode AnimationBase::configureInternal(const AnimBaseConfig& cfg,
       return ErrorCode::FAILURE;
     }
 
-    _img = new Image;
+    _img = WidgetAllocator::create<Image>();
+    if (nullptr == _img) {
+      LOGERR("Error, bad alloc for animation Image with rsrcId: %" PRIu64,
+             _cfg.rsrcId);
+      return ErrorCode::FAILURE;
+    }
     _img->create(_cfg.rsrcId);
   } else {
     _img = cfg.externalImage;
@@ -110,7 +114,7 @@ void AnimationBase::resetConfigInternal() {
   if (AnimImageType::INTERNAL == _cfg.animImageType) {
     if (nullptr != _img) {
       _img->destroy();
-      delete _img;
+      WidgetAllocator::destroy(_img);
       _img = nullptr;
     }
   }
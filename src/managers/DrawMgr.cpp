@@ -2,20 +2,32 @@
 #include "manager_utils/managers/DrawMgr.h"
 
 // System headers
+#include <chrono>
 
 // Other libraries headers
 #include "sdl_utils/drawing/Renderer.h"
 #include "utils/input/InputEvent.h"
 #include "utils/debug/FunctionTracer.h"
+#include "utils/LimitValues.h"
 #include "utils/ErrorCode.h"
 #include "utils/log/Log.h"
 
 // Own components headers
+#include "manager_utils/trace/Tracer.h"
 
 DrawMgr *gDrawMgr = nullptr;
 
 DrawMgr::DrawMgr(const DrawMgrConfig &cfg)
-    : _renderer(nullptr), _maxFrames(0), _config(cfg) {
+    : _renderer(nullptr), _mailboxQueue(nullptr), _maxFrames(0),
+      _config(cfg), _lastDroppedFramesCount(0), _finishedFramesCount(0),
+      _lastScreenshotFrame(INIT_UINT64_VALUE), _isRendererLocked(true) {
+  _submitStateCmdCb = [this](const RendererCmd rendererCmd,
+                             const uint8_t *data, const uint64_t bytes) {
+    _frameStats.onRendererCmd(rendererCmd, bytes);
+    submitRendererCmd(rendererCmd, data, bytes);
+  };
+  _framePacer.setMode(_config.framePacingMode);
+  setMaxFrameRate(_config.maxFrameRate);
 }
 
 DrawMgr::~DrawMgr() noexcept {
@@ -31,15 +43,38 @@ ErrorCode DrawMgr::init() {
     return ErrorCode::FAILURE;
   }
 
-  if (ErrorCode::SUCCESS != _window.init(_config.monitorWindowConfig)) {
-    LOGERR("_window.init() failed");
-    return ErrorCode::FAILURE;
+  {
+    const TraceZone zone("DrawMgr::windowInit");
+    if (ErrorCode::SUCCESS != _window.init(_config.monitorWindowConfig)) {
+      LOGERR("_window.init() failed");
+      return ErrorCode::FAILURE;
+    }
   }
   _config.rendererConfig.window = _window.getNativeWindow();
 
-  if (ErrorCode::SUCCESS != _renderer->init(_config.rendererConfig)) {
-    LOGERR("_renderer.init() failed");
-    return ErrorCode::FAILURE;
+  {
+    const TraceZone zone("DrawMgr::rendererInit");
+    if (ErrorCode::SUCCESS != _renderer->init(_config.rendererConfig)) {
+      LOGERR("_renderer.init() failed");
+      return ErrorCode::FAILURE;
+    }
+  }
+
+  _frameStats.init(_config.frameStatsHistorySize);
+  _screenshotQueue.init();
+
+  if (RenderQueueMode::MAILBOX == _config.renderQueueMode) {
+    if (RendererPolicy::MULTI_THREADED != _renderer->getRendererPolicy()) {
+      LOGERR("Warning, RenderQueueMode::MAILBOX is only applicable for "
+             "RendererPolicy::MULTI_THREADED. Falling back to "
+             "RenderQueueMode::DOUBLE_BUFFERED");
+    } else {
+      _mailboxQueue = new MailboxRenderQueue;
+      if (ErrorCode::SUCCESS != _mailboxQueue->init(_renderer)) {
+        LOGERR("_mailboxQueue->init() failed");
+        return ErrorCode::FAILURE;
+      }
+    }
   }
 
   return ErrorCode::SUCCESS;
@@ -52,6 +87,14 @@ ErrorCode DrawMgr::recover() {
 void DrawMgr::deinit() {
   TRACE_ENTRY_EXIT;
 
+  _traceRecorder.stop();
+  _screenshotQueue.deinit();
+
+  if (nullptr != _mailboxQueue) {
+    delete _mailboxQueue;
+    _mailboxQueue = nullptr;
+  }
+
   if (nullptr != _renderer) {
     delete _renderer;
     _renderer = nullptr;
@@ -65,14 +108,21 @@ const char* DrawMgr::getName() {
 }
 
 void DrawMgr::shutdownRenderer() {
+  // the submit thread must be stopped while the render thread is still
+  // able to consume its pending back buffer swap
+  if (nullptr != _mailboxQueue) {
+    _mailboxQueue->deinit();
+  }
   _renderer->shutdownRenderer_UT();
 }
 
 void DrawMgr::startRenderingLoop() {
+  Tracer::setThreadName("render");
   _renderer->executeRenderCommands_RT();
 }
 
 void DrawMgr::process() {
+  processScreenshots();
 }
 
 void DrawMgr::handleEvent([[maybe_unused]]const InputEvent &e) {
@@ -83,60 +133,298 @@ void DrawMgr::setSDLContainers(SDLContainers *containers) {
 }
 
 void DrawMgr::clearScreen() {
+  _framePacer.onFrameStart();
+  _frameStats.onFrameStart();
+  _traceRecorder.recordFrameBegin();
+
+  if (nullptr != _mailboxQueue) {
+    _mailboxQueue->clearScreen();
+    return;
+  }
   _renderer->clearScreen_UT();
 }
 
 void DrawMgr::finishFrame(const bool overrideRendererLockCheck) {
-  _renderer->finishFrame_UT(overrideRendererLockCheck);
+  const TraceZone zone("DrawMgr::finishFrame");
+  _frameStats.onFinishFrameStart();
+
+  _stateCmdCoalescer.flush(_submitStateCmdCb);
+  _frameStats.onStateCmds(_stateCmdCoalescer.getReceivedCmdsCount(),
+                          _stateCmdCoalescer.getSubmittedCmdsCount());
+  _stateCmdCoalescer.resetCounters();
+
+  _traceRecorder.recordFrameEnd(overrideRendererLockCheck);
+
+  if (nullptr != _mailboxQueue) {
+    _mailboxQueue->finishFrame(overrideRendererLockCheck,
+                               _frameStats.getCurrFrameId());
+
+    const uint64_t droppedFrames = _mailboxQueue->getDroppedFramesCount();
+    _frameStats.onDroppedFrames(droppedFrames - _lastDroppedFramesCount);
+    _lastDroppedFramesCount = droppedFrames;
+
+    _mailboxQueue->takeRenderTimes(_completedRenderTimes);
+    for (const auto &renderTime : _completedRenderTimes) {
+      _frameStats.onRenderTime(renderTime.frameId, renderTime.renderTimeUs);
+    }
+  } else {
+    _renderer->finishFrame_UT(overrideRendererLockCheck);
+    if (RendererPolicy::SINGLE_THREADED == _renderer->getRendererPolicy()) {
+      _frameStats.onFrameRendered();
+    } else {
+      _frameStats.onFrameHandedOff();
+    }
+  }
+  ++_finishedFramesCount;
+  _frameStats.onFinishFrameEnd();
+
+  _framePacer.onFrameEnd();
 }
 
 void DrawMgr::addDrawCmd(const DrawParams &drawParams) const {
+  _frameStats.onDrawCmd(sizeof(drawParams));
+  _traceRecorder.recordDrawCmd(drawParams);
+
+  if (nullptr != _mailboxQueue) {
+    _mailboxQueue->addDrawCmd(drawParams);
+    return;
+  }
   _renderer->addDrawCmd_UT(drawParams);
 }
 
 void DrawMgr::addRendererCmd(const RendererCmd rendererCmd, const uint8_t *data,
                              const uint64_t bytes) {
-  _renderer->addRendererCmd_UT(rendererCmd, data, bytes);
+  // the pending texture state commands must reach the renderer before
+  // any command that could draw immediately (e.g. Fbo update)
+  _stateCmdCoalescer.flush(_submitStateCmdCb);
+  _frameStats.onRendererCmd(rendererCmd, bytes);
+  submitRendererCmd(rendererCmd, data, bytes);
 }
 
 void DrawMgr::addRendererData(const uint8_t *data, const uint64_t bytes) {
+  _stateCmdCoalescer.flush(_submitStateCmdCb);
+  _frameStats.onRendererData(bytes);
+  _traceRecorder.recordRendererData(data, bytes);
+
+  if (nullptr != _mailboxQueue) {
+    _mailboxQueue->addRendererData(data, bytes);
+    return;
+  }
   _renderer->addRendererData_UT(data, bytes);
 }
 
+void DrawMgr::changeTextureBlendMode(const WidgetType widgetType,
+                                     const uint64_t containerId,
+                                     const BlendMode blendMode) {
+  _stateCmdCoalescer.addBlendModeCmd(widgetType, containerId, blendMode);
+}
+
+void DrawMgr::changeTextureOpacity(const WidgetType widgetType,
+                                   const uint64_t containerId,
+                                   const int32_t opacity) {
+  _stateCmdCoalescer.addOpacityCmd(widgetType, containerId, opacity);
+}
+
+void DrawMgr::onTextureCreated(const WidgetType widgetType,
+                               const uint64_t containerId,
+                               const int32_t width, const int32_t height) {
+  RenderTraceTexture texture;
+  texture.containerId = containerId;
+  texture.width = width;
+  texture.height = height;
+  texture.widgetType = widgetType;
+  _traceRecorder.recordTexture(RenderTraceRecordType::TEXTURE_CREATED,
+                               texture);
+}
+
+void DrawMgr::onTextureRecreated(const WidgetType widgetType,
+                                 const uint64_t containerId) {
+  _stateCmdCoalescer.onTextureRecreated(widgetType, containerId);
+}
+
+void DrawMgr::onTextureDestroyed(const WidgetType widgetType,
+                                 const uint64_t containerId) {
+  _stateCmdCoalescer.onTextureDestroyed(widgetType, containerId);
+
+  RenderTraceTexture texture;
+  texture.containerId = containerId;
+  texture.widgetType = widgetType;
+  _traceRecorder.recordTexture(RenderTraceRecordType::TEXTURE_DESTROYED,
+                               texture);
+}
+
 void DrawMgr::swapBackBuffers() {
+  const auto swapStartTime = std::chrono::steady_clock::now();
+  const auto lock = acquireRendererLock();
   _renderer->swapBackBuffers_UT();
+  _frameStats.onSwapBackBuffers(
+      std::chrono::duration_cast<std::chrono::microseconds>(
+          std::chrono::steady_clock::now() - swapStartTime).count());
 }
 
 void DrawMgr::takeScreenshot(const char *file,
                              const ScreenshotContainer container,
                              const int32_t quality) {
+  _stateCmdCoalescer.flush(_submitStateCmdCb);
+
+  if (nullptr != _mailboxQueue) {
+    _mailboxQueue->takeScreenshot(file, container, quality);
+    return;
+  }
   _renderer->takeScreenshot_UT(file, container, quality);
 }
 
+ErrorCode DrawMgr::takeScreenshotAsync(
+    const char *file, const ScreenshotContainer container,
+    const int32_t quality,
+    const AsyncScreenshotQueue::ScreenshotDoneCb &doneCb) {
+  return _screenshotQueue.addRequest(file, container, quality, doneCb);
+}
+
 uint32_t DrawMgr::getTotalWidgetCount() const {
+  const auto lock = acquireRendererLock();
   return _renderer->getTotalWidgetCount_UT();
 }
 
 ErrorCode DrawMgr::unlockRenderer() {
+  _traceRecorder.recordOp(RenderTraceRecordType::UNLOCK_RENDERER);
+  if (nullptr != _mailboxQueue) {
+    if (!_isRendererLocked) {
+      LOGERR("Error, renderer is already unlocked");
+      return ErrorCode::FAILURE;
+    }
+    _isRendererLocked = false;
+    _mailboxQueue->unlockRenderer();
+    return ErrorCode::SUCCESS;
+  }
   return _renderer->unlockRenderer_UT();
 }
 
 ErrorCode DrawMgr::lockRenderer() {
+  _traceRecorder.recordOp(RenderTraceRecordType::LOCK_RENDERER);
+  if (nullptr != _mailboxQueue) {
+    if (_isRendererLocked) {
+      LOGERR("Error, renderer is already locked");
+      return ErrorCode::FAILURE;
+    }
+    _isRendererLocked = true;
+    _mailboxQueue->lockRenderer();
+    return ErrorCode::SUCCESS;
+  }
   return _renderer->lockRenderer_UT();
 }
 
 void DrawMgr::moveGlobalX(const int32_t x) {
+  _traceRecorder.recordOp(RenderTraceRecordType::MOVE_GLOBAL_X, x);
+  if (nullptr != _mailboxQueue) {
+    _mailboxQueue->moveGlobalX(x);
+    return;
+  }
   _renderer->moveGlobalX_UT(x);
 }
 
 void DrawMgr::moveGlobalY(const int32_t y) {
+  _traceRecorder.recordOp(RenderTraceRecordType::MOVE_GLOBAL_Y, y);
+  if (nullptr != _mailboxQueue) {
+    _mailboxQueue->moveGlobalY(y);
+    return;
+  }
   _renderer->moveGlobalY_UT(y);
 }
 
 void DrawMgr::resetAbsoluteGlobalMovement() {
+  _traceRecorder.recordOp(RenderTraceRecordType::RESET_GLOBAL_MOVEMENT);
+  if (nullptr != _mailboxQueue) {
+    _mailboxQueue->resetAbsoluteGlobalMovement();
+    return;
+  }
   _renderer->resetAbsoluteGlobalMovement_UT();
 }
 
+std::unique_lock<std::mutex> DrawMgr::acquireRendererLock() const {
+  if (nullptr == _mailboxQueue) {
+    // the update thread is the only user of the Renderer update API
+    return std::unique_lock<std::mutex>();
+  }
+  return _mailboxQueue->acquireRendererLock();
+}
+
+void DrawMgr::addResourceOp(const std::function<void()> &op) {
+  // the pending texture state commands could target the resource
+  _stateCmdCoalescer.flush(_submitStateCmdCb);
+
+  if (nullptr != _mailboxQueue) {
+    _mailboxQueue->addResourceOp(op);
+    return;
+  }
+  op();
+}
+
+uint64_t DrawMgr::getDroppedFramesCount() const {
+  if (nullptr == _mailboxQueue) {
+    return 0;
+  }
+  return _mailboxQueue->getDroppedFramesCount();
+}
+
+void DrawMgr::processScreenshots() {
+  /* The renderer executes the commands of a frame only after the frame
+   * is handed to it.
+   * DOUBLE_BUFFERED - wait for the finishFrame() after the next one to
+   *                   return (the render thread is done with the buffer
+   *                   only when the following back buffer swap happens)
+   * MAILBOX         - the submit thread reports the submission that
+   *                   contained the screenshot -> wait for the next
+   *                   submission to be completed
+   * */
+  constexpr uint64_t DOUBLE_BUFFERED_COMPLETION_DELAY = 2;
+
+  const uint64_t currMarker = (nullptr != _mailboxQueue) ?
+      _mailboxQueue->getCompletedScreenshotsCount() : _finishedFramesCount;
+  _screenshotQueue.dispatchCompleted(currMarker);
+
+  // issue at most a single screenshot per frame
+  if (!_screenshotQueue.hasPendingRequests() ||
+      (_lastScreenshotFrame == _finishedFramesCount)) {
+    return;
+  }
+
+  const uint64_t completionMarker = (nullptr != _mailboxQueue) ?
+      _mailboxQueue->getRecordedScreenshotsCount() + 1 :
+      _finishedFramesCount + DOUBLE_BUFFERED_COMPLETION_DELAY;
+  const AsyncScreenshotQueue::Request *request =
+      _screenshotQueue.issueNextRequest(completionMarker);
+  _lastScreenshotFrame = _finishedFramesCount;
+
+  // the queue moves the file to its final path once it is validated
+  takeScreenshot(request->tempFile.c_str(), request->container,
+                 request->quality);
+}
+
+ErrorCode DrawMgr::startTraceRecording(const char *file) {
+  return _traceRecorder.start(file, _config.monitorWindowConfig.width,
+                              _config.monitorWindowConfig.height);
+}
+
+void DrawMgr::stopTraceRecording() {
+  _traceRecorder.stop();
+}
+
+void DrawMgr::submitRendererCmd(const RendererCmd rendererCmd,
+                                const uint8_t *data, const uint64_t bytes) {
+  _traceRecorder.recordRendererCmd(rendererCmd, data, bytes);
+  if (nullptr != _mailboxQueue) {
+    _mailboxQueue->addRendererCmd(rendererCmd, data, bytes);
+    return;
+  }
+  _renderer->addRendererCmd_UT(rendererCmd, data, bytes);
+}
+
+void DrawMgr::setMaxFrameRate(const uint32_t maxFrames) {
+  _maxFrames = maxFrames;
+  _framePacer.setTargetFrameRate(maxFrames);
+}
+
 RendererPolicy DrawMgr::getRendererPolicy() const {
   return _renderer->getRendererPolicy();
 }
@@ -2,6 +2,9 @@
 #include "manager_utils/managers/ManagerHandler.h"
 
 //System headers
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
 
 //Other libraries headers
 #include "utils/log/Log.h"
@@ -10,64 +13,225 @@
 #include "manager_utils/managers/config/ManagerHandlerConfig.h"
 #include "manager_utils/managers/DrawMgr.h"
 #include "manager_utils/managers/RsrcMgr.h"
+#include "manager_utils/managers/SoundMgr.h"
 #include "manager_utils/managers/TimerMgr.h"
+#include "manager_utils/trace/Tracer.h"
+
+namespace {
+constexpr int64_t OVERRUN_LOG_INTERVAL_US = 1000000;
+
+int64_t getNowUs() {
+  using namespace std::chrono;
+  return duration_cast<microseconds>(
+      steady_clock::now().time_since_epoch()).count();
+}
+}
 
 ErrorCode ManagerHandler::init(const ManagerHandlerConfig &cfg) {
-  if (ErrorCode::SUCCESS != allocateManagers(cfg)) {
-    LOGERR("allocateManagers() failed -> Terminating...");
-    return ErrorCode::FAILURE;
+  // the managers are processed on the thread that initializes them
+  Tracer::setThreadName("update");
+
+  _traceFile = cfg.traceFile;
+  if (!_traceFile.empty()) {
+    //flushes append -> start a new trace
+    std::remove(_traceFile.c_str());
+    _traceFlushIntervalUs =
+        static_cast<int64_t>(cfg.traceFlushIntervalMs) * 1000;
+    _nextTraceFlushUs = getNowUs() + _traceFlushIntervalUs;
   }
 
-  Time initTime;
-  //gDrawMgr should be initialized first, because it contains the renderer
-  //Other managers (such as the RsrcMgr) needs it's renderer
-  //to load graphical resources
-  if (ErrorCode::SUCCESS != _managers[Managers::DRAW_MGR_IDX]->init()) {
-    LOGERR("Error in %s init() -> Terminating...",
-        _managers[Managers::DRAW_MGR_IDX]->getName());
+  _startupProfileFile = cfg.startupProfileFile;
+  if (!_startupProfileFile.empty()) {
+    std::remove(_startupProfileFile.c_str());
+    _startupProfiler.start(cfg.startupProfileTopAssetsCount);
+    gStartupProfiler = &_startupProfiler;
+  }
+
+  if (!_traceFile.empty() || !_startupProfileFile.empty()) {
+    Tracer::enable(cfg.traceEventsPerThread);
+  }
+  const TraceZone initZone("ManagerHandler::init");
+
+  _frameBudgetUs = cfg.frameBudgetUs;
+  _timingHistorySize = cfg.managerTimingHistorySize;
+  if (ErrorCode::SUCCESS != allocateManagers(cfg)) {
+    LOGERR("allocateManagers() failed -> Terminating...");
     return ErrorCode::FAILURE;
   }
 
-  //IMPORTANT: set renderer for SDLContainers
-  gRsrcMgr->setRenderer(gDrawMgr->getRenderer());
+  /** gDrawMgr should be initialized first, because it contains the renderer.
+   *  Other managers (such as the RsrcMgr) needs it's renderer
+   *  to load graphical resources.
+   *  The managers are initialized in sequence. Their init() work is either
+   *  bound to the renderer thread (window creation and texture uploads) or
+   *  already parallelized internally (the SDLContainers image decoding),
+   *  so running them on separate threads does not shorten the startup.
+   * */
+  _startupTimeline = StartupTimeline();
+  const int64_t initStartUs = getNowUs();
+  for (const ManagerEntry &entry : _managers) {
+    MgrBase *manager = entry.manager;
+    if (Managers::RSRC_MGR_IDX == entry.managerIdx) {
+      //IMPORTANT: set renderer for SDLContainers
+      gRsrcMgr->setRenderer(gDrawMgr->getRenderer());
+    }
 
-  for (int32_t i = 1; i < Managers::TOTAL_MGRS_COUNT; ++i) {
-    if (ErrorCode::SUCCESS != _managers[i]->init()) {
-      LOGERR("Error in %s init() -> Terminating...", _managers[i]->getName());
-      return ErrorCode::FAILURE;
+    StartupTimelineEvent event;
+    event.name = manager->getName();
+    event.startUs = getNowUs() - initStartUs;
+    {
+      const TraceZone zone(manager->getName());
+      if (ErrorCode::SUCCESS != manager->init()) {
+        LOGERR("Error in %s init() -> Terminating...", manager->getName());
+        return ErrorCode::FAILURE;
+      }
     }
+    event.durationUs = getNowUs() - initStartUs - event.startUs;
+    _startupTimeline.events.push_back(event);
 
-    LOG("%s init() passed successfully for [%" PRId64" ms]", _managers[i]->getName(),
-        initTime.getElapsed().toMilliseconds());
+    LOG("%s init() passed successfully for [%" PRId64" ms]",
+        manager->getName(), event.durationUs / 1000);
   }
+  _startupTimeline.totalUs = getNowUs() - initStartUs;
 
   return ErrorCode::SUCCESS;
 }
 
 void ManagerHandler::deinit() {
+  finishStartupProfile();
+
   /** Following the logic that DrawMgr should be initialized first ->
    * it should be deinitialized last
    * / a.k.a. last one to shut the door :) /
    * */
-  for (int32_t i = Managers::TOTAL_MGRS_COUNT - 1; i >= 0; --i) {
-    if (_managers[i]) //Sanity check
+  for (auto it = _managers.rbegin(); it != _managers.rend(); ++it) {
+    if (it->manager) //Sanity check
     {
-      _managers[i]->deinit();
+      it->manager->deinit();
 
-      delete _managers[i];
-      _managers[i] = nullptr;
+      delete it->manager;
+      it->manager = nullptr;
 
-      nullifyGlobalManager(i);
+      nullifyGlobalManager(it->managerIdx);
     }
   }
+  _managers.clear();
+
+  if (!_traceFile.empty()) {
+    Tracer::disable();
+    if (ErrorCode::SUCCESS != Tracer::flushChromeTrace(_traceFile.c_str())) {
+      LOGERR("Error, flushChromeTrace() failed");
+    }
+    _traceFile.clear();
+  }
 }
 
 void ManagerHandler::process() {
-  for (int32_t i = 0; i < Managers::TOTAL_MGRS_COUNT; ++i) {
-    _managers[i]->process();
+  if (_startupProfiler.isActive()) {
+    finishStartupProfile();
+  }
+
+  const TraceZone frameZone("ManagerHandler::process");
+  const int64_t nowUs = getNowUs();
+  const int64_t frameDeadlineUs = nowUs + _frameBudgetUs;
+  for (ManagerEntry &entry : _managers) {
+    if (0 != entry.processIntervalUs) {
+      if (nowUs < entry.nextProcessUs) {
+        continue;
+      }
+
+      //keep the rate steady, but do not try to catch up after a stall
+      entry.nextProcessUs += entry.processIntervalUs;
+      if (entry.nextProcessUs <= nowUs) {
+        entry.nextProcessUs = nowUs + entry.processIntervalUs;
+      }
+    }
+
+    const TraceZone mgrZone(entry.manager->getName());
+    const int64_t startUs = getNowUs();
+    if (0 >= _frameBudgetUs) {
+      entry.manager->process();
+      entry.timingHistory.addSample(getNowUs() - startUs);
+      continue;
+    }
+
+    const int64_t sliceUs = std::max<int64_t>(0, frameDeadlineUs - startUs);
+    entry.manager->processWithinBudget(sliceUs);
+    const int64_t durationUs = getNowUs() - startUs;
+    entry.timingHistory.addSample(durationUs);
+
+    //a constantly exceeded slice would otherwise be logged on every frame
+    if (durationUs > sliceUs) {
+      ++entry.overrunsCount;
+      if (entry.nextOverrunLogUs <= startUs) {
+        entry.nextOverrunLogUs = startUs + OVERRUN_LOG_INTERVAL_US;
+        LOGY("Warning, %s::process() took [%" PRId64" us], which exceeds "
+             "its frame budget slice of [%" PRId64" us]. Deferrable work is "
+             "postponed to the next frame. Total budget overruns: [%"
+             PRIu64"]", entry.manager->getName(), durationUs, sliceUs,
+             entry.overrunsCount);
+      }
+    }
+  }
+
+  //outside of the managers budget
+  flushTraceIfDue(getNowUs());
+}
+
+void ManagerHandler::getManagerTimings(
+    std::vector<ManagerTiming> &outTimings) const {
+  outTimings.clear();
+  outTimings.reserve(_managers.size());
+  for (const ManagerEntry &entry : _managers) {
+    ManagerTiming timing;
+    timing.name = entry.manager->getName();
+    timing.lastUs = entry.timingHistory.getLastUs();
+    timing.avgUs = entry.timingHistory.getAverageUs();
+    timing.p99Us = entry.timingHistory.getPercentileUs(99);
+    timing.maxUs = entry.timingHistory.getMaxUs();
+    timing.processedCount = entry.timingHistory.getTotalSamplesCount();
+    timing.overrunsCount = entry.overrunsCount;
+    outTimings.push_back(timing);
   }
 }
 
+void ManagerHandler::logManagerTimings() const {
+  std::vector<ManagerTiming> timings;
+  getManagerTimings(timings);
+  for (const ManagerTiming &timing : timings) {
+    LOG("%s process() - avg: [%" PRId64" us], p99: [%" PRId64" us], max: [%"
+        PRId64" us], processed: [%" PRIu64"], budget overruns: [%" PRIu64"]",
+        timing.name, timing.avgUs, timing.p99Us, timing.maxUs,
+        timing.processedCount, timing.overrunsCount);
+  }
+}
+
+ErrorCode ManagerHandler::registerManager(MgrBase *manager,
+                                          const uint32_t processRateHz) {
+  if (nullptr == manager) {
+    LOGERR("Error, nullptr manager provided");
+    return ErrorCode::FAILURE;
+  }
+
+  //the built-in managers are created on ::init() and are always first
+  if (_managers.empty()) {
+    LOGERR("Error, %s registered before ManagerHandler::init()",
+           manager->getName());
+    delete manager;
+    return ErrorCode::FAILURE;
+  }
+
+  if (ErrorCode::SUCCESS != manager->init()) {
+    LOGERR("Error, %s init() failed", manager->getName());
+    manager->deinit();
+    delete manager;
+    return ErrorCode::FAILURE;
+  }
+
+  addManagerEntry(manager, Managers::CUSTOM_MGR_IDX, processRateHz);
+  return ErrorCode::SUCCESS;
+}
+
 ErrorCode ManagerHandler::allocateManagers(const ManagerHandlerConfig &cfg) {
   //gDrawMgr should be initialized first, because it contains the renderer
   //Other managers may want to load graphical resources
@@ -83,21 +247,84 @@ ErrorCode ManagerHandler::allocateManagers(const ManagerHandlerConfig &cfg) {
     return ErrorCode::FAILURE;
   }
 
-  gTimerMgr = new TimerMgr;
-  if (!gTimerMgr) {
-    LOGERR("Error! Bad alloc for TimerMgr class -> Terminating...");
-    return ErrorCode::FAILURE;
+  //put global managers into the registry so they can be easily iterated
+  //and used polymorphically
+  addManagerEntry(gDrawMgr, Managers::DRAW_MGR_IDX, cfg.drawMgrProcessRateHz);
+  addManagerEntry(gRsrcMgr, Managers::RSRC_MGR_IDX, cfg.rsrcMgrProcessRateHz);
+
+  if (cfg.enableTimerMgr) {
+    gTimerMgr = new TimerMgr;
+    if (!gTimerMgr) {
+      LOGERR("Error! Bad alloc for TimerMgr class -> Terminating...");
+      return ErrorCode::FAILURE;
+    }
+    addManagerEntry(gTimerMgr, Managers::TIMER_MGR_IDX,
+                    cfg.timerMgrProcessRateHz);
   }
 
-  //put global managers into container so they can be easily iterated
-  //and used polymorphically
-  _managers[Managers::DRAW_MGR_IDX] = gDrawMgr;
-  _managers[Managers::RSRC_MGR_IDX] = gRsrcMgr;
-  _managers[Managers::TIMER_MGR_IDX] = gTimerMgr;
+  if (cfg.enableSoundMgr) {
+    gSoundMgr = new SoundMgr(cfg.soundMgrCfg);
+    if (!gSoundMgr) {
+      LOGERR("Error! Bad alloc for SoundMgr class -> Terminating...");
+      return ErrorCode::FAILURE;
+    }
+    addManagerEntry(gSoundMgr, Managers::SOUND_MGR_IDX,
+                    cfg.soundMgrProcessRateHz);
+  }
 
   return ErrorCode::SUCCESS;
 }
 
+void ManagerHandler::addManagerEntry(MgrBase *manager,
+                                     const int32_t managerIdx,
+                                     const uint32_t processRateHz) {
+  ManagerEntry entry;
+  entry.manager = manager;
+  entry.managerIdx = managerIdx;
+  entry.timingHistory.init(_timingHistorySize);
+  if (0 != processRateHz) {
+    entry.processIntervalUs = 1000000 / processRateHz;
+    entry.nextProcessUs = getNowUs();
+  }
+  _managers.push_back(entry);
+}
+
+void ManagerHandler::finishStartupProfile() {
+  if (!_startupProfiler.isActive()) {
+    return;
+  }
+
+  _startupProfiler.stop();
+  gStartupProfiler = nullptr;
+
+  _startupProfiler.logSummary();
+
+  //the startup zones are drained into the startup profile, so they are
+  //not part of the traceFile
+  if (ErrorCode::SUCCESS !=
+      Tracer::flushChromeTrace(_startupProfileFile.c_str())) {
+    LOGERR("Error, flushChromeTrace() failed for the startup profile");
+  }
+
+  if (_traceFile.empty()) {
+    Tracer::disable();
+  }
+}
+
+void ManagerHandler::flushTraceIfDue(const int64_t nowUs) {
+  if (_traceFile.empty() || (0 == _traceFlushIntervalUs) ||
+      (nowUs < _nextTraceFlushUs)) {
+    return;
+  }
+  _nextTraceFlushUs = nowUs + _traceFlushIntervalUs;
+
+  if (ErrorCode::SUCCESS != Tracer::flushChromeTrace(_traceFile.c_str())) {
+    LOGERR("Error, flushChromeTrace() failed. Tracing is disabled");
+    Tracer::disable();
+    _traceFile.clear();
+  }
+}
+
 void ManagerHandler::nullifyGlobalManager(const int32_t managerId) {
   /** Explicitly set the singleton pointer to nullptr, because someone might
    * still try to use them -> if so, the sanity checks should catch them
@@ -115,6 +342,14 @@ void ManagerHandler::nullifyGlobalManager(const int32_t managerId) {
     gTimerMgr = nullptr;
     break;
 
+  case Managers::SOUND_MGR_IDX:
+    gSoundMgr = nullptr;
+    break;
+
+  case Managers::CUSTOM_MGR_IDX:
+    //custom managers are not bound to a global pointer
+    break;
+
   default:
     LOGERR("Unknown managerId: %d provided", managerId);
     break;
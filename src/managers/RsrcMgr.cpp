@@ -2,6 +2,10 @@
 #include "manager_utils/managers/RsrcMgr.h"
 
 // System headers
+#include <algorithm>
+#include <chrono>
+#include <limits>
+#include <string>
 
 // Other libraries headers
 #include "utils/input/InputEvent.h"
@@ -10,11 +14,39 @@
 #include "utils/log/Log.h"
 
 // Own components headers
+#include "manager_utils/managers/DrawMgr.h"
+#include "manager_utils/managers/helpers/StartupProfiler.h"
+#include "manager_utils/trace/Tracer.h"
 
 RsrcMgr* gRsrcMgr = nullptr;
 
-RsrcMgr::RsrcMgr(const SDLContainersConfig &cfg) : SDLContainers(cfg) {
+namespace {
+constexpr int64_t DEFAULT_ASYNC_TEXT_BUDGET_US = 2000;
+constexpr uint64_t DEFAULT_STREAMING_UPLOAD_BUDGET_BYTES = 8 * 1024 * 1024;
 
+// RGBA32 texture
+constexpr uint64_t RSRC_BYTES_PER_PIXEL = 4;
+}
+
+RsrcMgr::RsrcMgr(const SDLContainersConfig &cfg)
+    : SDLContainers(cfg), _asyncTextBudgetUs(DEFAULT_ASYNC_TEXT_BUDGET_US),
+      _streamingUploadBudgetBytes(DEFAULT_STREAMING_UPLOAD_BUDGET_BYTES) {
+  _asyncTextQueue.init(
+      [this](const uint64_t fontId, const char *text, const Color &color,
+             int32_t &outTextId, int32_t &outWidth, int32_t &outHeight) {
+        return loadText(fontId, text, color, outTextId, outWidth, outHeight);
+      },
+      [this](const int32_t textId) {
+        unloadText(textId);
+      });
+
+  _resourceStreamer.init(
+      [this](const std::vector<uint64_t> &rsrcIds, const int32_t batchId) {
+        loadResourceOnDemandMultiple(rsrcIds, batchId);
+      },
+      [this](const uint64_t rsrcId) {
+        unloadResourceOnDemandSingle(rsrcId);
+      });
 }
 
 RsrcMgr::~RsrcMgr() noexcept {
@@ -24,6 +56,8 @@ RsrcMgr::~RsrcMgr() noexcept {
 ErrorCode RsrcMgr::init() {
   TRACE_ENTRY_EXIT;
 
+  // static resources, fonts and Fbos. The containers load internally
+  const TraceZone zone("SDLContainers::init");
   if (ErrorCode::SUCCESS != SDLContainers::init()) {
     LOGERR("Error in SDLContainers::init() -> Terminating ...");
     return ErrorCode::FAILURE;
@@ -37,6 +71,29 @@ ErrorCode RsrcMgr::recover() {
 }
 
 void RsrcMgr::deinit() {
+  // the atlases hold Fbos and texts -> destroy them while the containers
+  // are still alive
+  _glyphAtlasCache.deinit();
+  _asyncTextQueue.clear();
+  _resourceStreamer.clear();
+  _loadingBatches.clear();
+  _waitingBatches.clear();
+  {
+    std::lock_guard<std::mutex> lock(_completedLoadBatchesMutex);
+    _completedLoadBatches.clear();
+  }
+
+  // SDLContainers::deinit() releases the retained textures
+  _rsrcIdsToProcess.clear();
+  _residencyCache.clear(_rsrcIdsToProcess);
+  for (const uint64_t rsrcId : _rsrcIdsToProcess) {
+    onImageUnloaded(rsrcId);
+  }
+
+  _unloadTextIds.clear();
+  _textCache.clear(_unloadTextIds);
+  unloadTexts(_unloadTextIds);
+
   SDLContainers::deinit();
 }
 
@@ -45,19 +102,474 @@ const char* RsrcMgr::getName() {
 }
 
 void RsrcMgr::process() {
+  processWithinBudget(std::numeric_limits<int64_t>::max());
+}
 
+void RsrcMgr::processWithinBudget(const int64_t budgetUs) {
+  using Clock = std::chrono::steady_clock;
+  const Clock::time_point startTime = Clock::now();
+
+  applyCompletedLoadBatches();
+  _glyphAtlasCache.process();
+  _asyncTextQueue.process(std::min(_asyncTextBudgetUs, budgetUs));
+
+  /** Once the slice is consumed only the most urgent streaming request
+   *  (and the overdue ones) is dispatched, so the text rasterization
+   *  could not starve the streaming
+   * */
+  const int64_t elapsedUs = std::chrono::duration_cast<
+      std::chrono::microseconds>(Clock::now() - startTime).count();
+  const uint64_t uploadBudgetBytes =
+      (elapsedUs < budgetUs) ? _streamingUploadBudgetBytes : 0;
+  _resourceStreamer.process(uploadBudgetBytes);
 }
 
 void RsrcMgr::handleEvent([[maybe_unused]]const InputEvent& e) {
 }
 
-void RsrcMgr::onLoadTextureMultipleCompleted(
-    [[maybe_unused]]const int32_t batchId) {
+void RsrcMgr::onLoadTextureMultipleCompleted(const int32_t batchId) {
+  // applied on the update thread with ::applyCompletedLoadBatches()
+  std::lock_guard<std::mutex> lock(_completedLoadBatchesMutex);
+  _completedLoadBatches.push_back(batchId);
 }
 
 uint64_t RsrcMgr::getGPUMemoryUsage() const {
+  // the resource operations could be executed on the submit thread
+  const auto lock = acquireRendererLock();
   return ResourceContainer::getGPUMemoryUsage() +
          TextContainer::getGPUMemoryUsage() +
          FboContainer::getGPUMemoryUsage();
 }
 
+GlyphAtlas *RsrcMgr::acquireGlyphAtlas(const uint64_t fontId,
+                                       const Color &color) {
+  return _glyphAtlasCache.acquire(fontId, color);
+}
+
+void RsrcMgr::releaseGlyphAtlas(const GlyphAtlas *atlas) {
+  _glyphAtlasCache.release(atlas);
+}
+
+ErrorCode RsrcMgr::loadText(const uint64_t fontId, const char *text,
+                            const Color &color, int32_t &outTextId,
+                            int32_t &outTextWidth, int32_t &outTextHeight) {
+  CachedTextData cachedData;
+  if (_textCache.acquire(fontId, text, color, cachedData)) {
+    outTextId = cachedData.textId;
+    outTextWidth = cachedData.width;
+    outTextHeight = cachedData.height;
+    return ErrorCode::SUCCESS;
+  }
+
+  {
+    const StartupAssetScope profileScope("text", fontId);
+    const auto lock = acquireRendererLock();
+    if (ErrorCode::SUCCESS != SDLContainers::loadText(fontId, text, color,
+            outTextId, outTextWidth, outTextHeight)) {
+      LOGERR("Error, SDLContainers::loadText() failed for fontId: %" PRIu64,
+             fontId);
+      return ErrorCode::FAILURE;
+    }
+  }
+  onTextCreated(outTextId, outTextWidth, outTextHeight);
+
+  cachedData.textId = outTextId;
+  cachedData.width = outTextWidth;
+  cachedData.height = outTextHeight;
+  _textCache.insert(fontId, text, color, cachedData);
+
+  return ErrorCode::SUCCESS;
+}
+
+void RsrcMgr::reloadText(const uint64_t fontId, const char *text,
+                         const Color &color, int32_t &textId,
+                         int32_t &outTextWidth, int32_t &outTextHeight) {
+  // private texts (e.g. made unique for alpha modulation) stay private
+  const bool wasCached = _textCache.isCached(textId);
+
+  // the new content/color could already be cached -> switch to it
+  CachedTextData cachedData;
+  if (wasCached && _textCache.acquire(fontId, text, color, cachedData)) {
+    unloadText(textId);
+    textId = cachedData.textId;
+    outTextWidth = cachedData.width;
+    outTextHeight = cachedData.height;
+    return;
+  }
+
+  // the text is detached before it is modified, so the texture is never
+  // changed under the other texts that share it
+  if (_textCache.detach(textId)) {
+    // still used by the others -> load a new texture for this text
+    const int32_t sharedTextId = textId;
+    {
+      const StartupAssetScope profileScope("text", fontId);
+      const auto lock = acquireRendererLock();
+      if (ErrorCode::SUCCESS != SDLContainers::loadText(fontId, text, color,
+              textId, outTextWidth, outTextHeight)) {
+        LOGERR("Error, SDLContainers::loadText() failed for fontId: %"
+               PRIu64, fontId);
+        textId = sharedTextId;
+        _textCache.reattach(sharedTextId);
+        return;
+      }
+    }
+  } else {
+    // not shared (anymore) -> modified in place
+    const auto lock = acquireRendererLock();
+    SDLContainers::reloadText(fontId, text, color, textId, outTextWidth,
+                              outTextHeight);
+  }
+  onTextCreated(textId, outTextWidth, outTextHeight);
+
+  if (wasCached) {
+    cachedData.textId = textId;
+    cachedData.width = outTextWidth;
+    cachedData.height = outTextHeight;
+    _textCache.insert(fontId, text, color, cachedData);
+  }
+}
+
+void RsrcMgr::unloadText(const int32_t textId) {
+  _unloadTextIds.clear();
+  _textCache.release(textId, _unloadTextIds);
+  unloadTexts(_unloadTextIds);
+}
+
+uint64_t RsrcMgr::loadTextAsync(const uint64_t fontId, const char *text,
+                                const Color &color) {
+  return _asyncTextQueue.submit(fontId, text, color);
+}
+
+bool RsrcMgr::pollTextAsync(const uint64_t ticket,
+                            AsyncTextResult &outResult) {
+  return _asyncTextQueue.poll(ticket, outResult);
+}
+
+void RsrcMgr::cancelTextAsync(const uint64_t ticket) {
+  _asyncTextQueue.cancel(ticket);
+}
+
+uint64_t RsrcMgr::loadResourceAsync(const uint64_t rsrcId,
+                                    const int32_t priority,
+                                    const int64_t deadlineMs) {
+  const ResourceData *rsrcData = nullptr;
+  if (ErrorCode::SUCCESS != getRsrcData(rsrcId, rsrcData)) {
+    LOGERR("Error, getRsrcData failed for rsrcId: %" PRIu64, rsrcId);
+    return _resourceStreamer.submitFailed();
+  }
+
+  return _resourceStreamer.submit(rsrcId, priority, deadlineMs,
+                                  getRsrcTextureBytes(rsrcId));
+}
+
+StreamRequestState RsrcMgr::pollResourceAsync(const uint64_t ticket) {
+  return _resourceStreamer.poll(ticket);
+}
+
+void RsrcMgr::cancelResourceAsync(const uint64_t ticket) {
+  _resourceStreamer.cancel(ticket);
+}
+
+void RsrcMgr::loadResourceOnDemandSingle(const uint64_t rsrcId) {
+  if (_residencyCache.acquire(rsrcId)) {
+    if (!_residencyCache.isLoading(rsrcId)) {
+      // the texture is still resident
+      return;
+    }
+
+    // an in-flight batch is still uploading it, but the caller expects
+    // the texture to be ready for drawing -> load it synchronously.
+    // The entry stays loading (not evictable) until the batch completes
+  } else {
+    _residencyCache.insert(rsrcId, getRsrcTextureBytes(rsrcId), false);
+    onImageLoaded(rsrcId);
+  }
+
+  // ordered with the unloads of the same rsrcId
+  addResourceOp([this, rsrcId]() {
+    const StartupAssetScope profileScope("texture", rsrcId);
+    SDLContainers::loadResourceOnDemandSingle(rsrcId);
+  });
+
+  enforceVramBudget();
+}
+
+void RsrcMgr::unloadResourceOnDemandSingle(const uint64_t rsrcId) {
+  if (_residencyCache.release(rsrcId)) {
+    onImageUnloaded(rsrcId);
+    addResourceOp([this, rsrcId]() {
+      SDLContainers::unloadResourceOnDemandSingle(rsrcId);
+    });
+    return;
+  }
+
+  enforceVramBudget();
+}
+
+void RsrcMgr::loadResourceOnDemandMultiple(
+    const std::vector<uint64_t> &rsrcIds, const int32_t batchId) {
+  // only the not resident textures are sent for loading. The batch is
+  // completed once both them and the ones, already loaded by other
+  // in-flight batches, are uploaded
+  _rsrcIdsToProcess.clear();
+  LoadBatch waitingBatch;
+  waitingBatch.batchId = batchId;
+  for (const uint64_t rsrcId : rsrcIds) {
+    if (_residencyCache.acquire(rsrcId)) {
+      if (_residencyCache.isLoading(rsrcId)) {
+        waitingBatch.rsrcIds.push_back(rsrcId);
+      }
+      continue;
+    }
+
+    _residencyCache.insert(rsrcId, getRsrcTextureBytes(rsrcId), true);
+    onImageLoaded(rsrcId);
+    _rsrcIdsToProcess.push_back(rsrcId);
+    waitingBatch.rsrcIds.push_back(rsrcId);
+  }
+
+  if (waitingBatch.rsrcIds.empty()) {
+    // everything is resident -> the batch is already completed
+    completeLoadBatch(batchId);
+    return;
+  }
+  _waitingBatches.push_back(std::move(waitingBatch));
+
+  if (!_rsrcIdsToProcess.empty()) {
+    LoadBatch loadingBatch;
+    loadingBatch.batchId = batchId;
+    loadingBatch.rsrcIds = _rsrcIdsToProcess;
+    _loadingBatches.push_back(std::move(loadingBatch));
+
+    addResourceOp([this, rsrcIds = _rsrcIdsToProcess, batchId]() {
+      // only the dispatch. The loading itself is asynchronous
+      const TraceZone zone("RsrcMgr::loadResourceOnDemandMultiple");
+      SDLContainers::loadResourceOnDemandMultiple(rsrcIds, batchId);
+    });
+  }
+
+  enforceVramBudget();
+}
+
+void RsrcMgr::unloadResourceOnDemandMultiple(
+    const std::vector<uint64_t> &rsrcIds) {
+  _rsrcIdsToProcess.clear();
+  for (const uint64_t rsrcId : rsrcIds) {
+    if (_residencyCache.release(rsrcId)) {
+      onImageUnloaded(rsrcId);
+      _rsrcIdsToProcess.push_back(rsrcId);
+    }
+  }
+
+  if (!_rsrcIdsToProcess.empty()) {
+    addResourceOp([this, rsrcIds = _rsrcIdsToProcess]() {
+      SDLContainers::unloadResourceOnDemandMultiple(rsrcIds);
+    });
+  }
+
+  enforceVramBudget();
+}
+
+uint32_t RsrcMgr::getOnDemandRefCount(const uint64_t rsrcId) const {
+  return _residencyCache.getRefCount(rsrcId);
+}
+
+void RsrcMgr::collectOnDemandRefCounts(
+    std::vector<std::pair<uint64_t, uint32_t>> &outRefCounts) const {
+  _residencyCache.collectRefCounts(outRefCounts);
+}
+
+void RsrcMgr::setVramBudget(const uint64_t vramBudgetBytes) {
+  _residencyCache.setVramBudget(vramBudgetBytes);
+  enforceVramBudget();
+}
+
+void RsrcMgr::makeTextUnique(int32_t &textId) {
+  uint64_t fontId = 0;
+  std::string content;
+  Color color = Colors::BLACK;
+  if (!_textCache.getTextSource(textId, fontId, content, color)) {
+    // already private
+    return;
+  }
+
+  if (!_textCache.detach(textId)) {
+    // the text was not shared -> it is private now
+    return;
+  }
+
+  int32_t textWidth = 0;
+  int32_t textHeight = 0;
+  int32_t privateTextId = 0;
+  {
+    const auto lock = acquireRendererLock();
+    if (ErrorCode::SUCCESS != SDLContainers::loadText(fontId, content.c_str(),
+            color, privateTextId, textWidth, textHeight)) {
+      LOGERR("Error, SDLContainers::loadText() failed for fontId: %" PRIu64
+             ". Text will remain shared", fontId);
+
+      // restore the released reference
+      _textCache.reattach(textId);
+      return;
+    }
+  }
+  onTextCreated(privateTextId, textWidth, textHeight);
+
+  textId = privateTextId;
+}
+
+void RsrcMgr::setMaxRetainedTexts(const uint32_t maxRetainedTexts) {
+  _textCache.setMaxRetainedTexts(maxRetainedTexts);
+}
+
+void RsrcMgr::unloadTexts(const std::vector<int32_t> &textIds) {
+  if (textIds.empty()) {
+    return;
+  }
+
+  // sanity check, because manager could already been destroyed
+  if (nullptr != gDrawMgr) {
+    for (const int32_t textId : textIds) {
+      gDrawMgr->onTextureDestroyed(WidgetType::TEXT,
+                                   static_cast<uint64_t>(textId));
+    }
+  }
+
+  addResourceOp([this, textIds]() {
+    for (const int32_t textId : textIds) {
+      SDLContainers::unloadText(textId);
+    }
+  });
+}
+
+void RsrcMgr::onTextCreated(const int32_t textId, const int32_t width,
+                            const int32_t height) {
+  // sanity check, because manager could already been destroyed
+  if (nullptr != gDrawMgr) {
+    gDrawMgr->onTextureCreated(WidgetType::TEXT,
+                               static_cast<uint64_t>(textId), width, height);
+  }
+}
+
+void RsrcMgr::onImageLoaded(const uint64_t rsrcId) {
+  // sanity check, because manager could already been destroyed
+  if (nullptr != gDrawMgr) {
+    gDrawMgr->onTextureRecreated(WidgetType::IMAGE, rsrcId);
+  }
+}
+
+void RsrcMgr::onImageUnloaded(const uint64_t rsrcId) {
+  // sanity check, because manager could already been destroyed
+  if (nullptr != gDrawMgr) {
+    gDrawMgr->onTextureDestroyed(WidgetType::IMAGE, rsrcId);
+  }
+}
+
+uint64_t RsrcMgr::getRsrcTextureBytes(const uint64_t rsrcId) {
+  const ResourceData *rsrcData = nullptr;
+  if (ErrorCode::SUCCESS != getRsrcData(rsrcId, rsrcData)) {
+    return 0;
+  }
+
+  return static_cast<uint64_t>(rsrcData->imageRect.w) *
+         static_cast<uint64_t>(rsrcData->imageRect.h) * RSRC_BYTES_PER_PIXEL;
+}
+
+void RsrcMgr::enforceVramBudget() {
+  _rsrcIdsToProcess.clear();
+  _residencyCache.collectEvictions(_rsrcIdsToProcess);
+  if (_rsrcIdsToProcess.empty()) {
+    return;
+  }
+
+  for (const uint64_t rsrcId : _rsrcIdsToProcess) {
+    onImageUnloaded(rsrcId);
+  }
+
+  addResourceOp([this, rsrcIds = _rsrcIdsToProcess]() {
+    SDLContainers::unloadResourceOnDemandMultiple(rsrcIds);
+  });
+}
+
+void RsrcMgr::applyCompletedLoadBatches() {
+  _completedLoadBatchesCopy.clear();
+  {
+    std::lock_guard<std::mutex> lock(_completedLoadBatchesMutex);
+    _completedLoadBatchesCopy.swap(_completedLoadBatches);
+  }
+
+  if (_completedLoadBatchesCopy.empty()) {
+    return;
+  }
+
+  const TraceZone zone("RsrcMgr::applyCompletedLoadBatches");
+  for (const int32_t batchId : _completedLoadBatchesCopy) {
+    // batch IDs could be reused -> batches are completed in dispatch order
+    const auto batchIt = std::find_if(_loadingBatches.begin(),
+        _loadingBatches.end(), [batchId](const LoadBatch &batch) {
+          return batchId == batch.batchId;
+        });
+    if (_loadingBatches.end() == batchIt) {
+      LOGERR("Error, received completion for unknown load batch: %d",
+             batchId);
+      continue;
+    }
+
+    for (const uint64_t rsrcId : batchIt->rsrcIds) {
+      _residencyCache.onLoaded(rsrcId);
+    }
+    _loadingBatches.erase(batchIt);
+  }
+
+  for (size_t i = 0; i < _waitingBatches.size();) {
+    std::vector<uint64_t> &waitRsrcIds = _waitingBatches[i].rsrcIds;
+    waitRsrcIds.erase(std::remove_if(waitRsrcIds.begin(), waitRsrcIds.end(),
+        [this](const uint64_t rsrcId) {
+          return !_residencyCache.isLoading(rsrcId);
+        }), waitRsrcIds.end());
+
+    if (!waitRsrcIds.empty()) {
+      ++i;
+      continue;
+    }
+
+    const int32_t batchId = _waitingBatches[i].batchId;
+    _waitingBatches.erase(_waitingBatches.begin() +
+                          static_cast<std::ptrdiff_t>(i));
+    completeLoadBatch(batchId);
+  }
+
+  // the loaded textures could be evicted now
+  enforceVramBudget();
+}
+
+void RsrcMgr::completeLoadBatch(const int32_t batchId) {
+  if (ResourceStreamer::isStreamingBatch(batchId)) {
+    _resourceStreamer.onBatchCompleted(batchId);
+  }
+}
+
+std::unique_lock<std::mutex> RsrcMgr::acquireRendererLock() const {
+  // sanity check, because manager could already been destroyed
+  if (nullptr == gDrawMgr) {
+    return std::unique_lock<std::mutex>();
+  }
+
+  return gDrawMgr->acquireRendererLock();
+}
+
+void RsrcMgr::addResourceOp(const std::function<void()> &op) {
+  // sanity check, because manager could already been destroyed
+  if (nullptr == gDrawMgr) {
+    op();
+    return;
+  }
+
+  gDrawMgr->addResourceOp([op]() {
+    // the operation could be deferred past the RsrcMgr lifetime
+    if (nullptr != gRsrcMgr) {
+      op();
+    }
+  });
+}
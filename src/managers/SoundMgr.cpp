@@ -4,8 +4,7 @@
 // System headers
 #include <cstring>
 #include <cstdint>
-#include <vector>
-#include <mutex>
+#include <chrono>
 
 // Other libraries headers
 #include "sdl_utils/sound/SoundMixer.h"
@@ -17,18 +16,22 @@
 #include "utils/log/Log.h"
 
 // Own components headers
+#include "manager_utils/managers/helpers/FinishedChannelQueue.h"
 #include "manager_utils/managers/RsrcMgr.h"
 #include "manager_utils/sound/SoundWidgetEndCb.h"
+#include "manager_utils/trace/Tracer.h"
 
 SoundMgr *gSoundMgr = nullptr;
 
-static std::vector<int32_t> finishedChannels;
-static std::mutex gSoundMutex;
+// filled by the SDL audio thread, drained by ::process()
+static FinishedChannelQueue gFinishedChannels;
 
-SoundMgr::SoundMgr()
-    : _panningMap(nullptr), _usedChannels(nullptr), _usedChannelsEndCb(nullptr),
-      _music(nullptr), _loadedMusicRsrcId(0),
-      _systemSoundLevel(SoundLevel::NONE) {
+SoundMgr::SoundMgr(const SoundMgrConfig &cfg)
+    : _voicesCount(cfg.voicesCount), _panningMap(nullptr),
+      _usedChannelsEndCb(nullptr), _music(nullptr), _loadedMusicRsrcId(0),
+      _systemSoundLevel(SoundLevel::NONE),
+      _recoveredDroppedChannelsCount(0) {
+  _triggerLimiter.setDefaultLimits(cfg.defaultPlaybackLimits);
 }
 
 SoundMgr::~SoundMgr() noexcept {
@@ -40,10 +43,25 @@ SoundMgr::~SoundMgr() noexcept {
 ErrorCode SoundMgr::init() {
   TRACE_ENTRY_EXIT;
 
+  // the channel 0 is reserved for the music
   if (ErrorCode::SUCCESS !=
-      SoundMixer::allocateSoundChannels(SUPPORTED_SOUND_CHANNELS)) {
+      _voicePool.init(_voicesCount, MUSIC_RESERVED_CHANNEL_ID + 1)) {
+    LOGERR("Error in _voicePool.init() for voicesCount: %d", _voicesCount);
+    return ErrorCode::FAILURE;
+  }
+
+  /** A channel could finish, be reused and finish again before the next
+   *  ::process() -> leave room for twice the channels count
+   * */
+  if (ErrorCode::SUCCESS != gFinishedChannels.init(2 * _voicesCount)) {
+    LOGERR("Error in gFinishedChannels.init()");
+    return ErrorCode::FAILURE;
+  }
+  _recoveredDroppedChannelsCount = 0;
+
+  if (ErrorCode::SUCCESS != SoundMixer::allocateSoundChannels(_voicesCount)) {
     LOGERR("Error in allocateSoundChannels() for requestedChannels: %d",
-        SUPPORTED_SOUND_CHANNELS);
+        _voicesCount);
     return ErrorCode::FAILURE;
   }
 
@@ -52,7 +70,7 @@ ErrorCode SoundMgr::init() {
     return ErrorCode::FAILURE;
   }
 
-  _panningMap = new int32_t[SUPPORTED_SOUND_CHANNELS];
+  _panningMap = new int32_t[_voicesCount];
 
   if (nullptr == _panningMap) {
     LOGERR("Error, bad alloc for _panningMap -> Terminating ...");
@@ -60,26 +78,16 @@ ErrorCode SoundMgr::init() {
   }
 
   // initialize all values to 0
-  memset(_panningMap, 0, sizeof(int32_t) * SUPPORTED_SOUND_CHANNELS);
+  memset(_panningMap, 0, sizeof(int32_t) * _voicesCount);
 
-  _usedChannels = new uint64_t[SUPPORTED_SOUND_CHANNELS];
-
-  if (nullptr == _usedChannels) {
-    LOGERR("Error, bad alloc for _usedChannels -> Terminating ...");
-    return ErrorCode::FAILURE;
-  }
-
-  // initialize all values to 0
-  memset(_usedChannels, 0, sizeof(uint64_t) * SUPPORTED_SOUND_CHANNELS);
-
-  _usedChannelsEndCb = new SoundWidgetEndCb*[SUPPORTED_SOUND_CHANNELS];
+  _usedChannelsEndCb = new SoundWidgetEndCb*[_voicesCount];
 
   if (nullptr == _usedChannelsEndCb) {
     LOGERR("Error, bad alloc for _usedChannelsEndCb -> Terminating...");
     return ErrorCode::FAILURE;
   }
 
-  for (int32_t i = 0; i < SUPPORTED_SOUND_CHANNELS; ++i) {
+  for (int32_t i = 0; i < _voicesCount; ++i) {
     _usedChannelsEndCb[i] = nullptr;
   }
 
@@ -93,9 +101,12 @@ ErrorCode SoundMgr::recover() {
 void SoundMgr::deinit() {
   TRACE_ENTRY_EXIT;
 
-  for (int32_t i = 0; i < SUPPORTED_SOUND_CHANNELS; ++i) {
-    _usedChannelsEndCb[i] = nullptr;
+  if (nullptr != _usedChannelsEndCb) {
+    for (int32_t i = 0; i < _voicesCount; ++i) {
+      _usedChannelsEndCb[i] = nullptr;
+    }
   }
+  _stolenChannelsEndCb.clear();
 
   // stop Music if it's playing
   SoundMixer::stopMusic();
@@ -104,7 +115,7 @@ void SoundMgr::deinit() {
   SoundMixer::stopAllChannels();
 
   /** NOTE: the memory freeing should occur last, because
-   *        some function use the _panningMap and _usedChannels
+   *        some function use the _panningMap and _usedChannelsEndCb
    * */
 
   // sanity check
@@ -113,17 +124,15 @@ void SoundMgr::deinit() {
     _panningMap = nullptr;
   }
 
-  // sanity check
-  if (nullptr != _usedChannels) {
-    delete[] _usedChannels;
-    _usedChannels = nullptr;
-  }
-
   // sanity check
   if (nullptr != _usedChannelsEndCb) {
     delete[] _usedChannelsEndCb;
     _usedChannelsEndCb = nullptr;
   }
+
+  // all channels are stopped -> the audio thread no longer pushes
+  gFinishedChannels.deinit();
+  _voicePool.deinit();
 }
 
 const char* SoundMgr::getName() {
@@ -131,14 +140,23 @@ const char* SoundMgr::getName() {
 }
 
 void SoundMgr::process() {
-  std::vector<int> finishedChannelsCopy;
+  const TraceZone zone("SoundMgr::process");
+  int32_t channel = INVALID_CHANNEL_ID;
+  while (gFinishedChannels.pop(channel)) {
+    /** A stolen channel is reset and reused right away. Its stale
+     *  finished notification must not reset the new sound
+     * */
+    if ( (MUSIC_RESERVED_CHANNEL_ID != channel) &&
+         SoundMixer::isChannelPlaying(channel)) {
+      continue;
+    }
+    resetChannel(channel);
+  }
 
-  gSoundMutex.lock();
-  std::swap(finishedChannelsCopy, finishedChannels);
-  gSoundMutex.unlock();
+  invokeStolenChannelsEndCb();
 
-  for (const int32_t channel : finishedChannelsCopy) {
-    resetChannel(channel);
+  if (_recoveredDroppedChannelsCount != gFinishedChannels.getDroppedCount()) {
+    recoverDroppedChannels();
   }
 }
 
@@ -236,15 +254,12 @@ void SoundMgr::trySelfUnloadMusic(const uint64_t rsrcId,
 
   // call the sound API to stop the music if it was playing
   if (SoundMixer::isMusicPlaying()) {
-    const int32_t channelId = findAssociatedChannel(rsrcId);
-    if (INVALID_CHANNEL_ID != channelId) {
-      /** Since the Music is about to be destroyed by it's destructor
-       * assure that it has no soundCallback attached, because
-       * sounds callbacks are executed on the next engine process()
-       * cycle when the widget will already be destroyed
-       * */
-      _usedChannelsEndCb[channelId] = nullptr;
-    }
+    /** Since the Music is about to be destroyed by it's destructor
+     * assure that it has no soundCallback attached, because
+     * sounds callbacks are executed on the next engine process()
+     * cycle when the widget will already be destroyed
+     * */
+    _usedChannelsEndCb[MUSIC_RESERVED_CHANNEL_ID] = nullptr;
 
     SoundMixer::stopMusic();
   }
@@ -294,7 +309,6 @@ void SoundMgr::playLoadedMusic(const int32_t loops, SoundWidgetEndCb *endCb) {
     return;
   }
 
-  _usedChannels[MUSIC_RESERVED_CHANNEL_ID] = _loadedMusicRsrcId;
   _usedChannelsEndCb[MUSIC_RESERVED_CHANNEL_ID] = endCb;
 }
 
@@ -311,13 +325,10 @@ void SoundMgr::stopLoadedMusic() {
   // call the sound API to stop the music
   SoundMixer::stopMusic();
 
-  const int32_t channelId = findAssociatedChannel(_loadedMusicRsrcId);
-  if (INVALID_CHANNEL_ID != channelId) {
-    // call music callback (if such is set)
-    if (nullptr != _usedChannelsEndCb[channelId]) {
-      _usedChannelsEndCb[channelId]->onSoundWidgetEnd();
-      // do not reset the callback variable - it might be used again
-    }
+  // call music callback (if such is set)
+  if (nullptr != _usedChannelsEndCb[MUSIC_RESERVED_CHANNEL_ID]) {
+    _usedChannelsEndCb[MUSIC_RESERVED_CHANNEL_ID]->onSoundWidgetEnd();
+    // do not reset the callback variable - it might be used again
   }
 }
 
@@ -371,7 +382,8 @@ SoundLevel SoundMgr::getChunkVolume(const uint64_t rsrcId) const {
 }
 
 void SoundMgr::playChunk(const uint64_t rsrcId, const int32_t loops,
-                         SoundWidgetEndCb *endCb) {
+                         SoundWidgetEndCb *endCb,
+                         const SoundPriority priority) {
   Mix_Chunk *chunk = nullptr;
   gRsrcMgr->getChunkSound(rsrcId, chunk);
   if (nullptr == chunk) {
@@ -380,29 +392,32 @@ void SoundMgr::playChunk(const uint64_t rsrcId, const int32_t loops,
     return;
   }
 
-  const int32_t channelId = getNextFreeChannel();
+  if (!acceptPlayRequest(rsrcId)) {
+    return;
+  }
+
+  const int32_t channelId = acquireChannel(rsrcId, priority);
   if (INVALID_CHANNEL_ID == channelId) {
-    LOGERR("Error, maximum sound supported channels count %d is reached. "
-           "Sound will with rsrcId: %" PRIu64" will not be played. Increase the "
-           "number of maximum sound supported channels SUPPORTED_SOUND_CHANNELS",
-           SUPPORTED_SOUND_CHANNELS, rsrcId);
+    _triggerLimiter.onPlayFailed(rsrcId);
     return;
   }
 
   if (channelId != SoundMixer::playChunk(chunk, channelId, loops)) {
     LOGERR("SDL_Mixer failed to play into the requested sound channelId: %d",
         channelId);
+    _voicePool.release(channelId);
+    _triggerLimiter.onPlayFailed(rsrcId);
     return;
   }
 
-  _usedChannels[channelId] = rsrcId;
   _usedChannelsEndCb[channelId] = endCb;
 }
 
 void SoundMgr::playChunkWithPanning(const uint64_t rsrcId, const int32_t loops,
                                     const uint8_t leftVolume,
                                     const uint8_t rightVolume,
-                                    SoundWidgetEndCb *endCb) {
+                                    SoundWidgetEndCb *endCb,
+                                    const SoundPriority priority) {
   Mix_Chunk *chunk = nullptr;
 
   gRsrcMgr->getChunkSound(rsrcId, chunk);
@@ -412,22 +427,24 @@ void SoundMgr::playChunkWithPanning(const uint64_t rsrcId, const int32_t loops,
     return;
   }
 
-  const int32_t channelId = getNextFreeChannel();
+  if (!acceptPlayRequest(rsrcId)) {
+    return;
+  }
+
+  const int32_t channelId = acquireChannel(rsrcId, priority);
   if (INVALID_CHANNEL_ID == channelId) {
-    LOGERR("Error, maximum sound supported channels count %d is reached. "
-           "Sound will with rsrcId: %" PRIu64" will not be played. Increase the "
-           "number of maximum sound supported channels SUPPORTED_SOUND_CHANNELS",
-           SUPPORTED_SOUND_CHANNELS, rsrcId);
+    _triggerLimiter.onPlayFailed(rsrcId);
     return;
   }
 
   if (channelId != SoundMixer::playChunk(chunk, channelId, loops)) {
     LOGERR("SDL_Mixer failed to play into the requested sound " "channelId: %d",
         channelId);
+    _voicePool.release(channelId);
+    _triggerLimiter.onPlayFailed(rsrcId);
     return;
   }
 
-  _usedChannels[channelId] = rsrcId;
   _usedChannelsEndCb[channelId] = endCb;
 
   if (ErrorCode::SUCCESS !=
@@ -452,7 +469,7 @@ void SoundMgr::stopChunk(const uint64_t rsrcId) {
 
 void SoundMgr::trySelfStopChunk(const uint64_t rsrcId,
                                 const SoundLevel soundLevel) {
-  const int32_t channelId = findAssociatedChannel(rsrcId);
+  int32_t channelId = findAssociatedChannel(rsrcId);
   if (INVALID_CHANNEL_ID == channelId) {
     return;
   }
@@ -478,14 +495,27 @@ void SoundMgr::trySelfStopChunk(const uint64_t rsrcId,
   }
 
   /** Since the widget is about to be destroyed by it's destructor
-   * assure that it has no soundCallback attached, because
+   * assure that none of its channels has a soundCallback attached, because
    * sounds callbacks are executed on the next engine process() cycle
-   * when the widget will already be destroyed
+   * when the widget will already be destroyed.
+   * The same applies for the deferred callbacks of its stolen voices
    * */
-  _usedChannelsEndCb[channelId] = nullptr;
+  for (auto it = _stolenChannelsEndCb.begin();
+       it != _stolenChannelsEndCb.end();) {
+    if (rsrcId == it->rsrcId) {
+      it = _stolenChannelsEndCb.erase(it);
+    } else {
+      ++it;
+    }
+  }
 
-  // call the sound API to stop the channel
-  SoundMixer::stopChannel(channelId);
+  while (INVALID_CHANNEL_ID != channelId) {
+    _usedChannelsEndCb[channelId] = nullptr;
+
+    // call the sound API to stop the channel
+    SoundMixer::stopChannel(channelId);
+    channelId = _voicePool.getNextSameRsrcVoice(channelId);
+  }
 }
 
 bool SoundMgr::isChunkPlaying(const uint64_t rsrcId) const {
@@ -532,11 +562,21 @@ void SoundMgr::resumeChunk(const uint64_t rsrcId) {
   resumeChannel(channelId);
 }
 
+void SoundMgr::setChunkPlaybackLimits(const uint64_t rsrcId,
+                                      const SoundPlaybackLimits &limits) {
+  _triggerLimiter.setLimits(rsrcId, limits);
+}
+
+void SoundMgr::resetChunkPlaybackLimits(const uint64_t rsrcId) {
+  _triggerLimiter.resetLimits(rsrcId);
+}
+
+SoundTriggerStats SoundMgr::getChunkTriggerStats(const uint64_t rsrcId) const {
+  return _triggerLimiter.getStats(rsrcId);
+}
+
 bool SoundMgr::isChannelPlaying(const int32_t channel) const {
-  if (0 > channel || SUPPORTED_SOUND_CHANNELS <= channel) {
-    LOGERR("Warning, invalid channel provided: %d. Max number of supported "
-           "sound channels currently supported: %d",
-           channel, SUPPORTED_SOUND_CHANNELS);
+  if (!isValidChannel(channel)) {
     return false;
   }
 
@@ -544,10 +584,7 @@ bool SoundMgr::isChannelPlaying(const int32_t channel) const {
 }
 
 bool SoundMgr::isChannelPaused(const int32_t channel) const {
-  if (0 > channel || SUPPORTED_SOUND_CHANNELS <= channel) {
-    LOGERR("Warning, invalid channel provided: %d. Max number of supported "
-           "sound channels currently supported: %d",
-           channel, SUPPORTED_SOUND_CHANNELS);
+  if (!isValidChannel(channel)) {
     return false;
   }
 
@@ -555,10 +592,7 @@ bool SoundMgr::isChannelPaused(const int32_t channel) const {
 }
 
 void SoundMgr::resumeChannel(const int32_t channel) {
-  if (0 > channel || SUPPORTED_SOUND_CHANNELS <= channel) {
-    LOGERR("Warning, invalid channel provided: %d. Max number of supported "
-           "sound channels currently supported: %d",
-           channel, SUPPORTED_SOUND_CHANNELS);
+  if (!isValidChannel(channel)) {
     return;
   }
 
@@ -566,10 +600,7 @@ void SoundMgr::resumeChannel(const int32_t channel) {
 }
 
 void SoundMgr::pauseChannel(const int32_t channel) {
-  if (0 > channel || SUPPORTED_SOUND_CHANNELS <= channel) {
-    LOGERR("Warning, invalid channel provided: %d. Max number of supported "
-           "sound channels currently supported: %d",
-           channel, SUPPORTED_SOUND_CHANNELS);
+  if (!isValidChannel(channel)) {
     return;
   }
 
@@ -579,10 +610,7 @@ void SoundMgr::pauseChannel(const int32_t channel) {
 ErrorCode SoundMgr::setChannelPanning(const int32_t channel,
                                       const uint8_t leftVolume,
                                       const uint8_t rightVolume) {
-  if (0 > channel || SUPPORTED_SOUND_CHANNELS <= channel) {
-    LOGERR("Warning, invalid channel provided: %d. Max number of supported "
-           "sound channels currently supported: %d",
-           channel, SUPPORTED_SOUND_CHANNELS);
+  if (!isValidChannel(channel)) {
     return ErrorCode::FAILURE;
   }
 
@@ -600,10 +628,7 @@ ErrorCode SoundMgr::setChannelPanning(const int32_t channel,
 }
 
 ErrorCode SoundMgr::resetChannelPanning(const int32_t channel) {
-  if (0 > channel || SUPPORTED_SOUND_CHANNELS <= channel) {
-    LOGERR("Warning, invalid channel provided: %d. Max number of "
-           "supported sound channels currently supported: %d",
-           channel, SUPPORTED_SOUND_CHANNELS);
+  if (!isValidChannel(channel)) {
     return ErrorCode::FAILURE;
   }
 
@@ -619,31 +644,52 @@ ErrorCode SoundMgr::resetChannelPanning(const int32_t channel) {
 }
 
 int32_t SoundMgr::findAssociatedChannel(const uint64_t rsrcId) const {
-  // keep in mind that (if not used correctly by the developer) there
-  // might be more than one associated channel for a provided rsrcId
-  for (int32_t i = 0; i < SUPPORTED_SOUND_CHANNELS; ++i) {
-    if (rsrcId == _usedChannels[i]) {
-      // channel found, end the search
-      return i;
-    }
+  // keep in mind that there might be more than one associated channel
+  // for a provided rsrcId
+  return _voicePool.findVoice(rsrcId);
+}
+
+int32_t SoundMgr::acquireChannel(const uint64_t rsrcId,
+                                 const SoundPriority priority) {
+  const int32_t channelId = _voicePool.allocate(rsrcId, priority);
+  if (INVALID_CHANNEL_ID != channelId) {
+    return channelId;
   }
 
-  // return invalid Id if channel is not found
-  return INVALID_CHANNEL_ID;
+  const int32_t victimChannelId = _voicePool.findStealCandidate(priority);
+  if (INVALID_CHANNEL_ID == victimChannelId) {
+    _voicePool.onSoundDropped();
+    LOGERR("Error, all %d sound channels are busy with higher priority sounds."
+           " Sound with rsrcId: %" PRIu64" will not be played. Consider "
+           "increasing SoundMgrConfig::voicesCount", _voicesCount - 1, rsrcId);
+    return INVALID_CHANNEL_ID;
+  }
+
+  // the stale finished notification is filtered out in ::process()
+  SoundMixer::stopChannel(victimChannelId);
+  releaseStolenChannel(victimChannelId);
+  _voicePool.onVoiceStolen();
+
+  return _voicePool.allocate(rsrcId, priority);
 }
 
-int32_t SoundMgr::getNextFreeChannel() const {
-  int32_t channelId = INVALID_CHANNEL_ID;
+bool SoundMgr::acceptPlayRequest(const uint64_t rsrcId) {
+  using namespace std::chrono;
+  const int64_t nowMs = duration_cast<milliseconds>(
+      steady_clock::now().time_since_epoch()).count();
 
-  // NOTE: the channelId 0 is reserved for Music
-  for (int32_t i = 1; i < SUPPORTED_SOUND_CHANNELS; ++i) {
-    if (0 == _usedChannels[i]) {
-      channelId = i;
-      break;
-    }
+  return SoundTriggerDecision::PLAY == _triggerLimiter.onPlayRequested(
+      rsrcId, _voicePool.getInstancesCount(rsrcId), nowMs);
+}
+
+bool SoundMgr::isValidChannel(const int32_t channel) const {
+  if (0 > channel || _voicesCount <= channel) {
+    LOGERR("Warning, invalid channel provided: %d. Max number of supported "
+           "sound channels currently supported: %d", channel, _voicesCount);
+    return false;
   }
 
-  return channelId;
+  return true;
 }
 
 void SoundMgr::resetChannel(const int32_t channel) {
@@ -661,10 +707,57 @@ void SoundMgr::resetChannel(const int32_t channel) {
     _usedChannelsEndCb[channel]->onSoundWidgetEnd();
     _usedChannelsEndCb[channel] = nullptr;
   }
-  _usedChannels[channel] = 0;
+  _voicePool.release(channel);
+}
+
+void SoundMgr::releaseStolenChannel(const int32_t channel) {
+  if (_panningMap[channel]) {
+    if (ErrorCode::SUCCESS != resetChannelPanning(channel)) {
+      LOGERR("Error in resetChannelPanning for channel: %d", channel);
+    }
+  }
+
+  if (nullptr != _usedChannelsEndCb[channel]) {
+    StolenChannelEndCb stolenEndCb;
+    stolenEndCb.endCb = _usedChannelsEndCb[channel];
+    stolenEndCb.rsrcId = _voicePool.getRsrcId(channel);
+    _stolenChannelsEndCb.push_back(stolenEndCb);
+    _usedChannelsEndCb[channel] = nullptr;
+  }
+  _voicePool.release(channel);
+}
+
+void SoundMgr::invokeStolenChannelsEndCb() {
+  /** A callback may steal another voice (appends to the list) or destroy
+   *  a sound widget (erases from the list) -> pop before invoking
+   * */
+  while (!_stolenChannelsEndCb.empty()) {
+    SoundWidgetEndCb *endCb = _stolenChannelsEndCb.front().endCb;
+    _stolenChannelsEndCb.pop_front();
+    endCb->onSoundWidgetEnd();
+  }
+}
+
+void SoundMgr::recoverDroppedChannels() {
+  const uint64_t droppedCount = gFinishedChannels.getDroppedCount();
+  LOGERR("Warning, %" PRIu64" finished channel notifications were dropped. "
+         "Resetting the voices, which are no longer playing",
+         droppedCount - _recoveredDroppedChannelsCount);
+  _recoveredDroppedChannelsCount = droppedCount;
+
+  /** A voice, whose notification is still queued, is reset here as well.
+   *  Its notification is handled later on as a stale one
+   *  (::resetChannel() of a free voice is a no-op)
+   * */
+  for (int32_t channel = MUSIC_RESERVED_CHANNEL_ID + 1;
+       channel < _voicesCount; ++channel) {
+    if (_voicePool.isBusy(channel) && !SoundMixer::isChannelPlaying(channel)) {
+      resetChannel(channel);
+    }
+  }
 }
 
 void SoundMgr::onChannelFinished(const int32_t channel) {
-  std::lock_guard<std::mutex> lock(gSoundMutex);
-  finishedChannels.emplace_back(channel);
+  // NOTE: executed on the SDL audio thread -> must not block or log
+  gFinishedChannels.push(channel);
 }
@@ -2,6 +2,8 @@
 #include "manager_utils/managers/TimerMgr.h"
 
 // System headers
+#include <chrono>
+#include <limits>
 
 // Other libraries headers
 #include "utils/input/InputEvent.h"
@@ -13,11 +15,14 @@
 
 // Own components headers
 #include "manager_utils/time/TimerClient.h"
+#include "manager_utils/trace/Tracer.h"
 
 TimerMgr* gTimerMgr = nullptr;
 
 TimerMgr::TimerMgr()
-    : _timerSpeed(TimerSpeed::NORMAL), _isTimerMgrPaused(false) {
+    : _timerSpeed(TimerSpeed::NORMAL),
+      _nextTimeoutTimerId(std::numeric_limits<int32_t>::min()),
+      _isTimerMgrPaused(false) {
 
 }
 
@@ -52,23 +57,62 @@ void TimerMgr::deinit() {
 const char* TimerMgr::getName() { return "TimerMgr"; }
 
 void TimerMgr::process() {
+  processTimers(NO_BUDGET);
+}
+
+void TimerMgr::processWithinBudget(const int64_t budgetUs) {
+  processTimers(budgetUs);
+}
+
+void TimerMgr::processTimers(const int64_t budgetUs) {
+  using Clock = std::chrono::steady_clock;
+
+  const TraceZone zone("TimerMgr::process");
   const int64_t millisecondsElapsed =
       _timeInternal.getElapsed().toMilliseconds();
+  for (auto &timer : _timerMap) {
+    if (!timer.second.isPaused) {  // timer paused, do not update it
+      timer.second.remaining -= millisecondsElapsed;
+    }
+  }
 
-  // do the loop update by hand so we can safely remove elements
-  for (auto it = _timerMap.begin(); it != _timerMap.end();) {
-    if (it->second.isPaused)  // timer paused, do not update it
-    {
-      ++it;
-      continue;
+  /** Expired timers, whose callbacks are deferred, keep their negative
+   *  remaining time, so they are executed on the next process call.
+   *  The next call starts from the first deferred timer (and wraps
+   *  around), so a small budget does not starve the timers with higher
+   *  IDs. At least one callback is executed per call
+   * */
+  const int32_t firstTimerId = _nextTimeoutTimerId;
+  _nextTimeoutTimerId = std::numeric_limits<int32_t>::min();
+  const Clock::time_point startTime = Clock::now();
+  bool isBudgetConsumed = false;
+
+  // do the loop update by hand so we can safely insert elements
+  const auto tryTimeout = [&](const auto it) {
+    if (it->second.isPaused || (0 <= it->second.remaining)) {
+      return true;
     }
 
-    it->second.remaining -= millisecondsElapsed;
-    if (0 > it->second.remaining) {
-      onTimerTimeout(it->first, it->second);
+    if (isBudgetConsumed) {
+      _nextTimeoutTimerId = it->first;
+      return false;
     }
 
-    ++it;  // normal loop update
+    onTimerTimeout(it->first, it->second);
+    isBudgetConsumed = (NO_BUDGET != budgetUs) &&
+        (budgetUs <= std::chrono::duration_cast<std::chrono::microseconds>(
+            Clock::now() - startTime).count());
+    return true;
+  };
+
+  bool isCompleted = true;
+  for (auto it = _timerMap.lower_bound(firstTimerId);
+       isCompleted && (_timerMap.end() != it); ++it) {
+    isCompleted = tryTimeout(it);
+  }
+  for (auto it = _timerMap.begin(); isCompleted &&
+       (_timerMap.end() != it) && (it->first < firstTimerId); ++it) {
+    isCompleted = tryTimeout(it);
   }
 
   // check for timers that requested external closing
@@ -438,9 +482,11 @@ void TimerMgr::onTimerTimeout(const int32_t timerId, TimerData& timerData) {
 
   // execute function callback with provided data
   if (TimerStructure::USER_DEFINED == timerData.timerStructure) {
+    const TraceZone zone("TimerMgr::timerCallback");
     timerData.func(timerData.funcData);
   } else  // it is timer client instance
   {
+    const TraceZone zone("TimerClient::onTimeout");
     timerData.tcInstance->onTimeout(timerId);
   }
 
@@ -0,0 +1,272 @@
+// Corresponding header
+#include "manager_utils/managers/helpers/AsyncScreenshotQueue.h"
+
+// System headers
+#include <filesystem>
+#include <system_error>
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "manager_utils/trace/Tracer.h"
+
+namespace {
+constexpr size_t MAX_PENDING_SCREENSHOTS = 16;
+constexpr auto TEMP_FILE_SUFFIX = ".partial";
+}
+
+AsyncScreenshotQueue::AsyncScreenshotQueue()
+    : _nextRequestId(1), _lastPreparedId(0), _isRunning(false),
+      _isAcceptingRequests(true) {
+}
+
+AsyncScreenshotQueue::~AsyncScreenshotQueue() noexcept {
+  deinit();
+}
+
+void AsyncScreenshotQueue::init() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_isRunning) {
+    return;
+  }
+  _isRunning = true;
+  _isAcceptingRequests = true;
+  _worker = std::thread(&AsyncScreenshotQueue::workerLoop, this);
+}
+
+void AsyncScreenshotQueue::deinit() {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _isRunning = false;
+    _fileJobs.clear();
+  }
+  _isAcceptingRequests = false;
+  _jobsCondVar.notify_one();
+
+  if (_worker.joinable()) {
+    _worker.join();
+  }
+
+  // the worker is joined -> the already validated requests keep their
+  // outcome. The rest will never complete
+  for (size_t i = 0; i < _validatedOutcomes.size(); ++i) {
+    _completedRequests.push_back(std::move(_validatingRequests.front()));
+    _validatingRequests.pop_front();
+  }
+  _completedOutcomes.swap(_validatedOutcomes);
+
+  for (std::deque<Request> *requests :
+      { &_validatingRequests, &_inFlightRequests, &_pendingRequests }) {
+    for (Request &request : *requests) {
+      discard(request);
+      _completedRequests.push_back(std::move(request));
+      _completedOutcomes.push_back(ErrorCode::FAILURE);
+    }
+    requests->clear();
+  }
+
+  for (size_t i = 0; i < _completedRequests.size(); ++i) {
+    const Request &request = _completedRequests[i];
+    if (request.doneCb) {
+      request.doneCb(request.file.c_str(), _completedOutcomes[i]);
+    }
+  }
+  _completedRequests.clear();
+  _completedOutcomes.clear();
+}
+
+ErrorCode AsyncScreenshotQueue::addRequest(const char *file,
+                                           const ScreenshotContainer container,
+                                           const int32_t quality,
+                                           const ScreenshotDoneCb &doneCb) {
+  if (nullptr == file) {
+    LOGERR("Error, nullptr provided for screenshot file");
+    return ErrorCode::FAILURE;
+  }
+
+  if (!_isAcceptingRequests) {
+    LOGERR("Error, screenshot queue is deinitialized. Screenshot: %s will "
+           "not be taken", file);
+    return ErrorCode::FAILURE;
+  }
+
+  if (MAX_PENDING_SCREENSHOTS <= _pendingRequests.size()) {
+    LOGERR("Error, maximum pending screenshots count: %zu reached. "
+           "Screenshot: %s will not be taken", MAX_PENDING_SCREENSHOTS, file);
+    return ErrorCode::FAILURE;
+  }
+
+  Request request;
+  request.file = file;
+  request.tempFile = request.file + TEMP_FILE_SUFFIX;
+  request.container = container;
+  request.quality = quality;
+  request.doneCb = doneCb;
+  request.id = _nextRequestId;
+  ++_nextRequestId;
+
+  FileJob job;
+  job.type = FileJobType::PREPARE;
+  job.tempFile = request.tempFile;
+  _pendingRequests.push_back(std::move(request));
+  pushFileJob(std::move(job));
+
+  return ErrorCode::SUCCESS;
+}
+
+const AsyncScreenshotQueue::Request *AsyncScreenshotQueue::issueNextRequest(
+    const uint64_t completionMarker) {
+  if (!hasPendingRequests()) {
+    return nullptr;
+  }
+
+  _inFlightRequests.push_back(std::move(_pendingRequests.front()));
+  _pendingRequests.pop_front();
+
+  Request &request = _inFlightRequests.back();
+  request.completionMarker = completionMarker;
+
+  return &request;
+}
+
+void AsyncScreenshotQueue::dispatchCompleted(const uint64_t currentMarker) {
+  // requests are issued with non-decreasing markers -> check the front only
+  while (!_inFlightRequests.empty() &&
+         (_inFlightRequests.front().completionMarker <= currentMarker)) {
+    Request &request = _inFlightRequests.front();
+
+    FileJob job;
+    job.type = FileJobType::VALIDATE;
+    job.file = request.file;
+    job.tempFile = request.tempFile;
+    pushFileJob(std::move(job));
+
+    _validatingRequests.push_back(std::move(request));
+    _inFlightRequests.pop_front();
+  }
+
+  if (_validatingRequests.empty()) {
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _completedOutcomes.swap(_validatedOutcomes);
+  }
+
+  // validations are executed in order
+  for (size_t i = 0; i < _completedOutcomes.size(); ++i) {
+    _completedRequests.push_back(std::move(_validatingRequests.front()));
+    _validatingRequests.pop_front();
+  }
+
+  for (size_t i = 0; i < _completedRequests.size(); ++i) {
+    const Request &request = _completedRequests[i];
+    if (request.doneCb) {
+      request.doneCb(request.file.c_str(), _completedOutcomes[i]);
+    }
+  }
+  _completedRequests.clear();
+  _completedOutcomes.clear();
+}
+
+bool AsyncScreenshotQueue::hasPendingRequests() const {
+  if (_pendingRequests.empty()) {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _pendingRequests.front().id <= _lastPreparedId;
+}
+
+void AsyncScreenshotQueue::workerLoop() {
+  Tracer::setThreadName("screenshot_io");
+  while (true) {
+    FileJob job;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _jobsCondVar.wait(lock, [this]() {
+        return !_fileJobs.empty() || !_isRunning;
+      });
+
+      if (!_isRunning) {
+        return;
+      }
+
+      job = std::move(_fileJobs.front());
+      _fileJobs.pop_front();
+    }
+
+    executeFileJob(job);
+  }
+}
+
+void AsyncScreenshotQueue::pushFileJob(FileJob &&job) {
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_isRunning) {
+      _fileJobs.push_back(std::move(job));
+      _jobsCondVar.notify_one();
+      return;
+    }
+  }
+
+  // no worker thread -> execute in place
+  executeFileJob(job);
+}
+
+void AsyncScreenshotQueue::executeFileJob(const FileJob &job) {
+  if (FileJobType::PREPARE == job.type) {
+    prepare(job);
+    std::lock_guard<std::mutex> lock(_mutex);
+    ++_lastPreparedId;
+    return;
+  }
+
+  const ErrorCode outcome = validate(job);
+  std::lock_guard<std::mutex> lock(_mutex);
+  _validatedOutcomes.push_back(outcome);
+}
+
+void AsyncScreenshotQueue::prepare(const FileJob &job) {
+  std::error_code errCode;
+  std::filesystem::remove(job.tempFile, errCode);
+  if (errCode) {
+    LOGERR("Error, stale screenshot file: %s could not be removed. "
+           "Reason: %s", job.tempFile.c_str(), errCode.message().c_str());
+  }
+}
+
+void AsyncScreenshotQueue::discard(const Request &request) {
+  std::error_code errCode;
+  std::filesystem::remove(request.tempFile, errCode);
+  if (errCode) {
+    LOGERR("Error, screenshot file: %s could not be removed. Reason: %s",
+           request.tempFile.c_str(), errCode.message().c_str());
+  }
+}
+
+ErrorCode AsyncScreenshotQueue::validate(const FileJob &job) {
+  const TraceZone zone("AsyncScreenshotQueue::validate");
+
+  // the renderer does not report screenshot errors -> validate the output.
+  // The temporary file was removed before the request was issued, so
+  // an existing one was written by this request
+  std::error_code errCode;
+  const uintmax_t fileSize = std::filesystem::file_size(job.tempFile, errCode);
+  if (errCode || (0 == fileSize)) {
+    LOGERR("Error, screenshot: %s was not written", job.file.c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  std::filesystem::rename(job.tempFile, job.file, errCode);
+  if (errCode) {
+    LOGERR("Error, screenshot: %s could not be moved to: %s. Reason: %s",
+           job.tempFile.c_str(), job.file.c_str(),
+           errCode.message().c_str());
+    return ErrorCode::FAILURE;
+  }
+
+  return ErrorCode::SUCCESS;
+}
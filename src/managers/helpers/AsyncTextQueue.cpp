@@ -0,0 +1,92 @@
+// Corresponding header
+#include "manager_utils/managers/helpers/AsyncTextQueue.h"
+
+// System headers
+#include <chrono>
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+
+AsyncTextQueue::AsyncTextQueue() : _nextTicket(INVALID_ASYNC_TEXT_TICKET + 1) {
+}
+
+void AsyncTextQueue::init(const LoadTextCb &loadTextCb,
+                          const UnloadTextCb &unloadTextCb) {
+  _loadTextCb = loadTextCb;
+  _unloadTextCb = unloadTextCb;
+}
+
+uint64_t AsyncTextQueue::submit(const uint64_t fontId, const char *text,
+                                const Color &color) {
+  Request request;
+  request.ticket = _nextTicket++;
+  request.fontId = fontId;
+  request.text = text;
+  request.color = color;
+  _pending.push_back(std::move(request));
+
+  return _pending.back().ticket;
+}
+
+bool AsyncTextQueue::poll(const uint64_t ticket, AsyncTextResult &outResult) {
+  const auto it = _completed.find(ticket);
+  if (_completed.end() == it) {
+    return false;
+  }
+
+  outResult = it->second;
+  _completed.erase(it);
+  return true;
+}
+
+void AsyncTextQueue::cancel(const uint64_t ticket) {
+  for (auto it = _pending.begin(); it != _pending.end(); ++it) {
+    if (ticket == it->ticket) {
+      _pending.erase(it);
+      return;
+    }
+  }
+
+  AsyncTextResult result;
+  if (poll(ticket, result) && (ErrorCode::SUCCESS == result.errCode)) {
+    _unloadTextCb(result.textId);
+  }
+}
+
+void AsyncTextQueue::process(const int64_t budgetUs) {
+  using Clock = std::chrono::steady_clock;
+  const Clock::time_point deadline =
+      Clock::now() + std::chrono::microseconds(budgetUs);
+
+  while (!_pending.empty()) {
+    const Request &request = _pending.front();
+
+    AsyncTextResult result;
+    result.errCode = _loadTextCb(request.fontId, request.text.c_str(),
+        request.color, result.textId, result.width, result.height);
+    if (ErrorCode::SUCCESS != result.errCode) {
+      LOGERR("Error, async text rasterization failed for fontId: %" PRIu64,
+             request.fontId);
+    }
+
+    _completed[request.ticket] = result;
+    _pending.pop_front();
+
+    if (Clock::now() >= deadline) {
+      break;
+    }
+  }
+}
+
+void AsyncTextQueue::clear() {
+  _pending.clear();
+
+  for (const auto &[ticket, result] : _completed) {
+    if (ErrorCode::SUCCESS == result.errCode) {
+      _unloadTextCb(result.textId);
+    }
+  }
+  _completed.clear();
+}
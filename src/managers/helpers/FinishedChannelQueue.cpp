@@ -0,0 +1,76 @@
+// Corresponding header
+#include "manager_utils/managers/helpers/FinishedChannelQueue.h"
+
+// System headers
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+
+FinishedChannelQueue::FinishedChannelQueue()
+    : _channels(nullptr), _mask(0), _head(0), _tail(0), _droppedCount(0) {
+}
+
+FinishedChannelQueue::~FinishedChannelQueue() noexcept {
+  deinit();
+}
+
+ErrorCode FinishedChannelQueue::init(const uint32_t capacity) {
+  if (0 == capacity) {
+    LOGERR("Error, FinishedChannelQueue capacity must not be 0");
+    return ErrorCode::FAILURE;
+  }
+
+  uint32_t roundedCapacity = 1;
+  while (roundedCapacity < capacity) {
+    roundedCapacity <<= 1;
+  }
+
+  deinit();
+  _channels = new int32_t[roundedCapacity];
+  _mask = roundedCapacity - 1;
+  _head.store(0, std::memory_order_relaxed);
+  _tail.store(0, std::memory_order_relaxed);
+  _droppedCount.store(0, std::memory_order_relaxed);
+
+  return ErrorCode::SUCCESS;
+}
+
+void FinishedChannelQueue::deinit() {
+  if (nullptr != _channels) {
+    delete[] _channels;
+    _channels = nullptr;
+  }
+  _mask = 0;
+}
+
+bool FinishedChannelQueue::push(const int32_t channel) {
+  if (nullptr == _channels) {
+    return false;
+  }
+
+  // indexes wrap around on uint32_t overflow -> the distance stays correct
+  const uint32_t head = _head.load(std::memory_order_relaxed);
+  const uint32_t tail = _tail.load(std::memory_order_acquire);
+  if (_mask < head - tail) {
+    _droppedCount.fetch_add(1, std::memory_order_relaxed);
+    return false;
+  }
+
+  _channels[head & _mask] = channel;
+  _head.store(head + 1, std::memory_order_release);
+  return true;
+}
+
+bool FinishedChannelQueue::pop(int32_t &outChannel) {
+  const uint32_t tail = _tail.load(std::memory_order_relaxed);
+  const uint32_t head = _head.load(std::memory_order_acquire);
+  if (head == tail) {
+    return false;
+  }
+
+  outChannel = _channels[tail & _mask];
+  _tail.store(tail + 1, std::memory_order_release);
+  return true;
+}
@@ -0,0 +1,144 @@
+// Corresponding header
+#include "manager_utils/managers/helpers/FramePacer.h"
+
+// System headers
+#include <cmath>
+#include <thread>
+
+// Other libraries headers
+
+// Own components headers
+
+namespace {
+using namespace std::literals;
+
+// initial guess of the OS scheduler oversleep for the LOW_LATENCY mode
+constexpr auto INITIAL_OVERSLEEP_ESTIMATE = 1ms;
+
+// upper boundary for the spin part of the wait
+constexpr auto MAX_OVERSLEEP_ESTIMATE = 4ms;
+
+// additional safety margin on top of the oversleep estimate
+constexpr auto SPIN_MARGIN = 200us;
+}
+
+FramePacer::FramePacer()
+    : _frameDuration(Clock::duration::zero()),
+      _oversleepEstimate(INITIAL_OVERSLEEP_ESTIMATE),
+      _mode(FramePacingMode::POWER_SAVING),
+      _isFrameStarted(false),
+      _frameTimeM2(0.0) {
+}
+
+void FramePacer::setTargetFrameRate(const uint32_t fps) {
+  if (0 == fps) {
+    _frameDuration = Clock::duration::zero();
+  } else {
+    _frameDuration = std::chrono::duration_cast<Clock::duration>(1s) / fps;
+  }
+
+  // start a new schedule from the next frame
+  _isFrameStarted = false;
+}
+
+void FramePacer::onFrameStart() {
+  const auto now = Clock::now();
+
+  if (_isFrameStarted) {
+    const auto frameTime = std::chrono::duration_cast<
+        std::chrono::microseconds>(now - _frameStartTime).count();
+    updateStats(frameTime);
+  } else {
+    _nextDeadline = now + _frameDuration;
+    _isFrameStarted = true;
+  }
+
+  _frameStartTime = now;
+}
+
+void FramePacer::onFrameEnd() {
+  if (Clock::duration::zero() == _frameDuration) {
+    return; // uncapped
+  }
+
+  const auto now = Clock::now();
+  if (now < _nextDeadline) {
+    waitUntil(_nextDeadline);
+    _nextDeadline += _frameDuration;
+    return;
+  }
+
+  ++_stats.missedDeadlines;
+  if ( (now - _nextDeadline) > _frameDuration) {
+    // too far behind -> re-synchronize instead of bursting frames
+    _nextDeadline = now + _frameDuration;
+  } else {
+    _nextDeadline += _frameDuration;
+  }
+}
+
+FramePacingStats FramePacer::getStats() const {
+  FramePacingStats stats = _stats;
+  if (1 < stats.frameCount) {
+    stats.jitterUs = std::sqrt(_frameTimeM2 / (stats.frameCount - 1));
+  }
+
+  return stats;
+}
+
+void FramePacer::resetStats() {
+  _stats = FramePacingStats();
+  _frameTimeM2 = 0.0;
+}
+
+void FramePacer::waitUntil(const Clock::time_point deadline) {
+  if (FramePacingMode::POWER_SAVING == _mode) {
+    const auto sleepStart = Clock::now();
+    std::this_thread::sleep_until(deadline);
+    _stats.sleepTimeUs += std::chrono::duration_cast<
+        std::chrono::microseconds>(Clock::now() - sleepStart).count();
+    return;
+  }
+
+  // FramePacingMode::LOW_LATENCY
+  const auto sleepTarget = deadline - _oversleepEstimate - SPIN_MARGIN;
+  auto now = Clock::now();
+  if (now < sleepTarget) {
+    const auto sleepStart = now;
+    std::this_thread::sleep_until(sleepTarget);
+    now = Clock::now();
+    _stats.sleepTimeUs += std::chrono::duration_cast<
+        std::chrono::microseconds>(now - sleepStart).count();
+
+    // adapt the safety margin to the observed scheduler behaviour
+    const auto oversleep = now - sleepTarget;
+    _oversleepEstimate = (_oversleepEstimate * 7 + oversleep) / 8;
+    if (_oversleepEstimate > MAX_OVERSLEEP_ESTIMATE) {
+      _oversleepEstimate = MAX_OVERSLEEP_ESTIMATE;
+    }
+  }
+
+  const auto spinStart = now;
+  while (now < deadline) {
+    std::this_thread::yield();
+    now = Clock::now();
+  }
+  _stats.spinTimeUs += std::chrono::duration_cast<std::chrono::microseconds>(
+      now - spinStart).count();
+}
+
+void FramePacer::updateStats(const int64_t frameTimeUs) {
+  if (0 == _stats.frameCount) {
+    _stats.minFrameTimeUs = frameTimeUs;
+    _stats.maxFrameTimeUs = frameTimeUs;
+  } else if (frameTimeUs < _stats.minFrameTimeUs) {
+    _stats.minFrameTimeUs = frameTimeUs;
+  } else if (frameTimeUs > _stats.maxFrameTimeUs) {
+    _stats.maxFrameTimeUs = frameTimeUs;
+  }
+
+  ++_stats.frameCount;
+  const double delta = frameTimeUs - _stats.avgFrameTimeUs;
+  _stats.avgFrameTimeUs += delta / _stats.frameCount;
+  _frameTimeM2 += delta * (frameTimeUs - _stats.avgFrameTimeUs);
+}
@@ -0,0 +1,126 @@
+// Corresponding header
+#include "manager_utils/managers/helpers/FrameStatsCollector.h"
+
+// System headers
+
+// Other libraries headers
+#include "utils/data_type/EnumClassUtils.h"
+
+// Own components headers
+
+void FrameStatsCollector::init(const uint32_t historySize) {
+  _history.clear();
+  _history.resize(historySize);
+  _historyHead = 0;
+  _historyCount = 0;
+}
+
+void FrameStatsCollector::onFrameStart() {
+  /* NOTE: _currFrame is not reset here on purpose.
+   * Commands that arrived between frames (for example Fbo updates
+   * performed before clearScreen()) are attributed to the new frame
+   * */
+  _frameStartTime = Clock::now();
+}
+
+void FrameStatsCollector::onRendererCmd(const RendererCmd rendererCmd,
+                                        const uint64_t bytes) {
+  ++_currFrame.rendererCmdCount;
+  _currFrame.rendererCmdBytes += bytes;
+
+  const auto cmdIdx = static_cast<uint32_t>(getEnumValue(rendererCmd));
+  if (MAX_TRACKED_RENDERER_CMDS > cmdIdx) {
+    ++_currFrame.rendererCmdCountByType[cmdIdx];
+  } else {
+    ++_currFrame.untrackedRendererCmdCount;
+  }
+
+  if (RendererCmd::UPDATE_RENDERER_TARGET == rendererCmd) {
+    ++_currFrame.fboUpdateCount;
+  }
+}
+
+void FrameStatsCollector::onStateCmds(const uint64_t received,
+                                      const uint64_t submitted) {
+  _currFrame.stateCmdsReceived += static_cast<uint32_t>(received);
+  _currFrame.stateCmdsSubmitted += static_cast<uint32_t>(submitted);
+}
+
+void FrameStatsCollector::onFinishFrameStart() {
+  _finishFrameStartTime = Clock::now();
+  _currFrame.updateTimeUs = elapsedUs(_frameStartTime, _finishFrameStartTime);
+}
+
+void FrameStatsCollector::onFrameHandedOff() {
+  const Clock::time_point now = Clock::now();
+  if (_hasHandedOffFrame) {
+    onRenderTime(_handedOffFrameId, elapsedUs(_handOffTime, now));
+  }
+
+  _hasHandedOffFrame = true;
+  _handedOffFrameId = _currFrame.frameId;
+  _handOffTime = now;
+}
+
+void FrameStatsCollector::onRenderTime(const uint64_t frameId,
+                                       const int64_t renderTimeUs) {
+  if (frameId == _currFrame.frameId) {
+    _currFrame.renderTimeUs = renderTimeUs;
+    return;
+  }
+  if (frameId == _lastFrame.frameId) {
+    _lastFrame.renderTimeUs = renderTimeUs;
+  }
+
+  // the completed frames are usually the newest ones in the history
+  const uint32_t historySize = static_cast<uint32_t>(_history.size());
+  for (uint32_t i = 1; i <= _historyCount; ++i) {
+    FrameStats &frame =
+        _history[(_historyHead + historySize - i) % historySize];
+    if (frameId == frame.frameId) {
+      frame.renderTimeUs = renderTimeUs;
+      return;
+    }
+    if (frameId > frame.frameId) {
+      return;
+    }
+  }
+}
+
+void FrameStatsCollector::onFinishFrameEnd() {
+  _currFrame.finishFrameTimeUs =
+      elapsedUs(_finishFrameStartTime, Clock::now());
+
+  _lastFrame = _currFrame;
+  if (!_history.empty()) {
+    _history[_historyHead] = _currFrame;
+    _historyHead = (_historyHead + 1) % _history.size();
+    if (_history.size() > _historyCount) {
+      ++_historyCount;
+    }
+  }
+
+  ++_nextFrameId;
+  _currFrame = FrameStats();
+  _currFrame.frameId = _nextFrameId;
+}
+
+const FrameStats &FrameStatsCollector::getLastFrameStats() const {
+  return _lastFrame;
+}
+
+void FrameStatsCollector::getHistory(
+    std::vector<FrameStats> &outHistory) const {
+  outHistory.clear();
+  if (0 == _historyCount) {
+    return;
+  }
+  outHistory.reserve(_historyCount);
+
+  const uint32_t historySize = static_cast<uint32_t>(_history.size());
+  const uint32_t oldestIdx =
+      (_historyHead + historySize - _historyCount) % historySize;
+  for (uint32_t i = 0; i < _historyCount; ++i) {
+    outHistory.push_back(_history[(oldestIdx + i) % historySize]);
+  }
+}
@@ -0,0 +1,71 @@
+// Corresponding header
+#include "manager_utils/managers/helpers/GlyphAtlasCache.h"
+
+// System headers
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "manager_utils/drawing/GlyphAtlas.h"
+#include "manager_utils/managers/helpers/StartupProfiler.h"
+
+GlyphAtlasCache::GlyphAtlasCache() = default;
+
+GlyphAtlasCache::~GlyphAtlasCache() noexcept {
+  deinit();
+}
+
+GlyphAtlas *GlyphAtlasCache::acquire(const uint64_t fontId,
+                                     const Color &color) {
+  for (Entry &entry : _entries) {
+    if ( (fontId == entry.atlas->getFontId()) &&
+         (color == entry.atlas->getColor())) {
+      ++entry.refCount;
+      return entry.atlas.get();
+    }
+  }
+
+  Entry entry;
+  entry.atlas = std::make_unique<GlyphAtlas>();
+  {
+    const StartupAssetScope profileScope("glyph_atlas", fontId);
+    if (ErrorCode::SUCCESS != entry.atlas->create(fontId, color)) {
+      LOGERR("Error, GlyphAtlas::create() failed for fontId: %" PRIu64,
+             fontId);
+      return nullptr;
+    }
+  }
+  entry.refCount = 1;
+
+  _entries.push_back(std::move(entry));
+  return _entries.back().atlas.get();
+}
+
+void GlyphAtlasCache::release(const GlyphAtlas *atlas) {
+  const size_t size = _entries.size();
+  for (size_t i = 0; i < size; ++i) {
+    if (atlas != _entries[i].atlas.get()) {
+      continue;
+    }
+
+    --_entries[i].refCount;
+    if (0 == _entries[i].refCount) {
+      _entries[i] = std::move(_entries.back());
+      _entries.pop_back();
+    }
+    return;
+  }
+
+  LOGERR("Error, trying to release an unknown GlyphAtlas");
+}
+
+void GlyphAtlasCache::process() {
+  for (Entry &entry : _entries) {
+    entry.atlas->process();
+  }
+}
+
+void GlyphAtlasCache::deinit() {
+  _entries.clear();
+}
@@ -0,0 +1,402 @@
+// Corresponding header
+#include "manager_utils/managers/helpers/MailboxRenderQueue.h"
+
+// System headers
+#include <cstring>
+#include <algorithm>
+
+// Other libraries headers
+#include "sdl_utils/drawing/Renderer.h"
+#include "sdl_utils/drawing/DrawParams.h"
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "manager_utils/trace/Tracer.h"
+
+MailboxRenderQueue::MailboxRenderQueue()
+    : _slots { WRITE_SLOT, READY_SLOT, READ_SLOT },
+      _renderer(nullptr),
+      _hasReadyFrame(false),
+      _isRunning(false),
+      _droppedFramesCount(0),
+      _submittedFramesCount(0),
+      _lastScreenshotSubmission(0),
+      _replayedScreenshotsCount(0),
+      _handedOffFrameId(0),
+      _hasHandedOffFrame(false),
+      _recordedScreenshotsCount(0),
+      _completedScreenshotsCount(0) {
+}
+
+MailboxRenderQueue::~MailboxRenderQueue() noexcept {
+  deinit();
+}
+
+ErrorCode MailboxRenderQueue::init(Renderer *renderer) {
+  if (nullptr == renderer) {
+    LOGERR("Error, nullptr provided for renderer");
+    return ErrorCode::FAILURE;
+  }
+  _renderer = renderer;
+
+  _isRunning = true;
+  _submitThread = std::thread(&MailboxRenderQueue::submitThreadLoop, this);
+
+  return ErrorCode::SUCCESS;
+}
+
+void MailboxRenderQueue::deinit() {
+  {
+    std::lock_guard<std::mutex> lock(_mailboxMutex);
+    _isRunning = false;
+  }
+  _readyCondVar.notify_one();
+
+  if (_submitThread.joinable()) {
+    _submitThread.join();
+  }
+
+  // the frames that were not submitted are never drawn, but the
+  // textures that they released must still be released
+  const std::lock_guard<std::mutex> rendererLock(_rendererMutex);
+  if (_hasReadyFrame) {
+    executeResourceOps(_frames[_slots[READY_SLOT]]);
+    _frames[_slots[READY_SLOT]].clear();
+    _hasReadyFrame = false;
+  }
+  executeResourceOps(_frames[_slots[WRITE_SLOT]]);
+  _frames[_slots[WRITE_SLOT]].clear();
+}
+
+void MailboxRenderQueue::clearScreen() {
+  recordOp(OpType::CLEAR_SCREEN);
+}
+
+void MailboxRenderQueue::finishFrame(const bool overrideRendererLockCheck,
+                                     const uint64_t frameId) {
+  recordOp(OpType::FINISH_FRAME, overrideRendererLockCheck ? 1 : 0,
+           reinterpret_cast<const uint8_t*>(&frameId), sizeof(frameId));
+
+  {
+    std::lock_guard<std::mutex> lock(_mailboxMutex);
+    if (_hasReadyFrame) {
+      RecordedFrame &readyFrame = _frames[_slots[READY_SLOT]];
+      if (rendersOutsideBackBuffer(readyFrame)) {
+        // its draw and finish operations complete the renderer target
+        // content -> submit both frames one after the other
+        appendFrame(_frames[_slots[WRITE_SLOT]], readyFrame);
+      } else {
+        // the submit thread did not catch up -> drop the older frame,
+        // but keep its non-draw operations in front of the newer one
+        stripDrawOps(readyFrame);
+        appendFrame(_frames[_slots[WRITE_SLOT]], readyFrame);
+        _droppedFramesCount.fetch_add(1, std::memory_order_relaxed);
+      }
+      _frames[_slots[WRITE_SLOT]].clear();
+    } else {
+      std::swap(_slots[WRITE_SLOT], _slots[READY_SLOT]);
+      _hasReadyFrame = true;
+    }
+  }
+  _readyCondVar.notify_one();
+}
+
+void MailboxRenderQueue::addDrawCmd(const DrawParams &drawParams) {
+  recordOp(OpType::DRAW, 0, reinterpret_cast<const uint8_t*>(&drawParams),
+           sizeof(drawParams));
+}
+
+void MailboxRenderQueue::addRendererCmd(const RendererCmd rendererCmd,
+                                        const uint8_t *data,
+                                        const uint64_t bytes) {
+  recordOp(OpType::RENDERER_CMD, 0, data, bytes, rendererCmd);
+}
+
+void MailboxRenderQueue::addRendererData(const uint8_t *data,
+                                         const uint64_t bytes) {
+  recordOp(OpType::RENDERER_DATA, 0, data, bytes);
+}
+
+void MailboxRenderQueue::lockRenderer() {
+  recordOp(OpType::LOCK_RENDERER);
+}
+
+void MailboxRenderQueue::unlockRenderer() {
+  recordOp(OpType::UNLOCK_RENDERER);
+}
+
+void MailboxRenderQueue::moveGlobalX(const int32_t x) {
+  recordOp(OpType::MOVE_GLOBAL_X, x);
+}
+
+void MailboxRenderQueue::moveGlobalY(const int32_t y) {
+  recordOp(OpType::MOVE_GLOBAL_Y, y);
+}
+
+void MailboxRenderQueue::resetAbsoluteGlobalMovement() {
+  recordOp(OpType::RESET_GLOBAL_MOVEMENT);
+}
+
+void MailboxRenderQueue::takeScreenshot(const char *file,
+                                        const ScreenshotContainer container,
+                                        const int32_t quality) {
+  // payload layout: [ScreenshotContainer][file path incl. '\0']
+  const uint64_t fileBytes = strlen(file) + 1;
+  std::vector<uint8_t> data(sizeof(container) + fileBytes);
+  memcpy(data.data(), &container, sizeof(container));
+  memcpy(data.data() + sizeof(container), file, fileBytes);
+
+  recordOp(OpType::SCREENSHOT, quality, data.data(), data.size());
+  ++_recordedScreenshotsCount;
+}
+
+void MailboxRenderQueue::addResourceOp(const ResourceOp &op) {
+  RecordedFrame &frame = _frames[_slots[WRITE_SLOT]];
+  recordOp(OpType::RESOURCE_OP,
+           static_cast<int32_t>(frame.resourceOps.size()));
+  frame.resourceOps.push_back(op);
+}
+
+uint64_t MailboxRenderQueue::getCompletedScreenshotsCount() {
+  // the submit thread stores the submission before the count
+  const uint64_t replayedCount =
+      _replayedScreenshotsCount.load(std::memory_order_acquire);
+  const uint64_t lastSubmission =
+      _lastScreenshotSubmission.load(std::memory_order_acquire);
+
+  // the render thread is done with a frame once the back buffer swap
+  // of the following submission returned
+  if (_submittedFramesCount.load(std::memory_order_acquire) >
+      lastSubmission) {
+    _completedScreenshotsCount = replayedCount;
+  }
+
+  return _completedScreenshotsCount;
+}
+
+void MailboxRenderQueue::takeRenderTimes(
+    std::vector<FrameRenderTime> &outRenderTimes) {
+  outRenderTimes.clear();
+  const std::lock_guard<std::mutex> lock(_renderTimesMutex);
+  _renderTimes.swap(outRenderTimes);
+}
+
+std::unique_lock<std::mutex> MailboxRenderQueue::acquireRendererLock() {
+  return std::unique_lock<std::mutex>(_rendererMutex);
+}
+
+void MailboxRenderQueue::submitThreadLoop() {
+  Tracer::setThreadName("render_submit");
+  while (true) {
+    int32_t readSlot = 0;
+    {
+      std::unique_lock<std::mutex> lock(_mailboxMutex);
+      _readyCondVar.wait(lock, [this]() {
+        return _hasReadyFrame || !_isRunning;
+      });
+
+      // NOTE: pending frames are not submitted on exit, because the
+      // render thread could already have left its rendering loop and
+      // Renderer::finishFrame_UT() would block forever
+      if (!_isRunning) {
+        return;
+      }
+
+      std::swap(_slots[READY_SLOT], _slots[READ_SLOT]);
+      _hasReadyFrame = false;
+      readSlot = _slots[READ_SLOT];
+    }
+
+    {
+      const TraceZone zone("MailboxRenderQueue::replay");
+      replay(_frames[readSlot]);
+    }
+    _frames[readSlot].clear();
+    _submittedFramesCount.fetch_add(1, std::memory_order_release);
+  }
+}
+
+void MailboxRenderQueue::recordOp(const OpType type, const int32_t param,
+                                  const uint8_t *data, const uint64_t bytes,
+                                  const RendererCmd rendererCmd) {
+  RecordedFrame &frame = _frames[_slots[WRITE_SLOT]];
+
+  RecordedOp op;
+  op.type = type;
+  op.param = param;
+  op.rendererCmd = rendererCmd;
+  op.dataOffset = frame.payload.size();
+  op.dataBytes = (nullptr == data) ? 0 : bytes;
+  if (0 != op.dataBytes) {
+    frame.payload.insert(frame.payload.end(), data, data + bytes);
+  }
+
+  frame.ops.push_back(op);
+}
+
+void MailboxRenderQueue::replay(const RecordedFrame &frame) {
+  const uint8_t *payload = frame.payload.data();
+
+  // released only for the back buffer swap, which could wait for
+  // the render thread
+  std::unique_lock<std::mutex> rendererLock(_rendererMutex);
+
+  for (const RecordedOp &op : frame.ops) {
+    const uint8_t *data = (0 == op.dataBytes) ?
+        nullptr : payload + op.dataOffset;
+
+    switch (op.type) {
+    case OpType::CLEAR_SCREEN:
+      _renderer->clearScreen_UT();
+      break;
+
+    case OpType::FINISH_FRAME: {
+      uint64_t frameId = 0;
+      memcpy(&frameId, data, sizeof(frameId));
+
+      rendererLock.unlock();
+      _renderer->finishFrame_UT(0 != op.param);
+      onFrameHandedOff(frameId);
+      rendererLock.lock();
+      break;
+    }
+
+    case OpType::DRAW: {
+      DrawParams drawParams;
+      memcpy(&drawParams, data, sizeof(drawParams));
+      _renderer->addDrawCmd_UT(drawParams);
+      break;
+    }
+
+    case OpType::RENDERER_CMD:
+      _renderer->addRendererCmd_UT(op.rendererCmd, data, op.dataBytes);
+      break;
+
+    case OpType::RENDERER_DATA:
+      _renderer->addRendererData_UT(data, op.dataBytes);
+      break;
+
+    case OpType::LOCK_RENDERER:
+      if (ErrorCode::SUCCESS != _renderer->lockRenderer_UT()) {
+        LOGERR("Error, recorded lockRenderer() failed");
+      }
+      break;
+
+    case OpType::UNLOCK_RENDERER:
+      if (ErrorCode::SUCCESS != _renderer->unlockRenderer_UT()) {
+        LOGERR("Error, recorded unlockRenderer() failed");
+      }
+      break;
+
+    case OpType::MOVE_GLOBAL_X:
+      _renderer->moveGlobalX_UT(op.param);
+      break;
+
+    case OpType::MOVE_GLOBAL_Y:
+      _renderer->moveGlobalY_UT(op.param);
+      break;
+
+    case OpType::RESET_GLOBAL_MOVEMENT:
+      _renderer->resetAbsoluteGlobalMovement_UT();
+      break;
+
+    case OpType::SCREENSHOT: {
+      ScreenshotContainer container;
+      memcpy(&container, data, sizeof(container));
+      const char *file =
+          reinterpret_cast<const char *>(data + sizeof(container));
+      _renderer->takeScreenshot_UT(file, container, op.param);
+
+      // the submit thread is the only one that advances the counter
+      _lastScreenshotSubmission.store(
+          _submittedFramesCount.load(std::memory_order_relaxed) + 1,
+          std::memory_order_release);
+      _replayedScreenshotsCount.fetch_add(1, std::memory_order_release);
+      break;
+    }
+
+    case OpType::RESOURCE_OP:
+      frame.resourceOps[static_cast<size_t>(op.param)]();
+      break;
+
+    default:
+      LOGERR("Error, received unsupported recorded operation");
+      break;
+    }
+  }
+}
+
+void MailboxRenderQueue::onFrameHandedOff(const uint64_t frameId) {
+  // Renderer::finishFrame_UT() returns once the render thread is done
+  // with the previous hand-off, which completes that frame
+  const auto now = std::chrono::steady_clock::now();
+  if (_hasHandedOffFrame) {
+    FrameRenderTime renderTime;
+    renderTime.frameId = _handedOffFrameId;
+    renderTime.renderTimeUs =
+        std::chrono::duration_cast<std::chrono::microseconds>(
+            now - _handOffTime).count();
+
+    const std::lock_guard<std::mutex> lock(_renderTimesMutex);
+    _renderTimes.push_back(renderTime);
+  }
+
+  _hasHandedOffFrame = true;
+  _handedOffFrameId = frameId;
+  _handOffTime = now;
+}
+
+void MailboxRenderQueue::executeResourceOps(const RecordedFrame &frame) {
+  for (const RecordedOp &op : frame.ops) {
+    if (OpType::RESOURCE_OP == op.type) {
+      frame.resourceOps[static_cast<size_t>(op.param)]();
+    }
+  }
+}
+
+bool MailboxRenderQueue::rendersOutsideBackBuffer(
+    const RecordedFrame &frame) {
+  for (const RecordedOp &op : frame.ops) {
+    if ((OpType::UNLOCK_RENDERER == op.type) ||
+        ((OpType::FINISH_FRAME == op.type) && (0 != op.param)) ||
+        ((OpType::RENDERER_CMD == op.type) &&
+         (RendererCmd::CHANGE_RENDERER_TARGET == op.rendererCmd))) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+void MailboxRenderQueue::stripDrawOps(RecordedFrame &frame) {
+  // the payload of the removed operations is simply left unused
+  auto isDrawOp = [](const RecordedOp &op) {
+    return (OpType::DRAW == op.type) || (OpType::CLEAR_SCREEN == op.type) ||
+           (OpType::FINISH_FRAME == op.type);
+  };
+
+  frame.ops.erase(
+      std::remove_if(frame.ops.begin(), frame.ops.end(), isDrawOp),
+      frame.ops.end());
+}
+
+void MailboxRenderQueue::appendFrame(const RecordedFrame &from,
+                                     RecordedFrame &to) {
+  const uint64_t payloadOffset = to.payload.size();
+  to.payload.insert(to.payload.end(), from.payload.begin(),
+                    from.payload.end());
+
+  const int32_t resourceOpOffset =
+      static_cast<int32_t>(to.resourceOps.size());
+  to.resourceOps.insert(to.resourceOps.end(), from.resourceOps.begin(),
+                        from.resourceOps.end());
+
+  to.ops.reserve(to.ops.size() + from.ops.size());
+  for (RecordedOp op : from.ops) {
+    op.dataOffset += payloadOffset;
+    if (OpType::RESOURCE_OP == op.type) {
+      op.param += resourceOpOffset;
+    }
+    to.ops.push_back(op);
+  }
+}
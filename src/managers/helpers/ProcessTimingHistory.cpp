@@ -0,0 +1,69 @@
+// Corresponding header
+#include "manager_utils/managers/helpers/ProcessTimingHistory.h"
+
+// System headers
+#include <algorithm>
+
+// Other libraries headers
+
+// Own components headers
+
+ProcessTimingHistory::ProcessTimingHistory()
+    : _nextIdx(0), _samplesCount(0), _windowSumUs(0), _lastUs(0),
+      _totalSamplesCount(0) {
+}
+
+void ProcessTimingHistory::init(const uint32_t capacity) {
+  _samples.assign(std::max<uint32_t>(1, capacity), 0);
+  _nextIdx = 0;
+  _samplesCount = 0;
+  _windowSumUs = 0;
+  _lastUs = 0;
+  _totalSamplesCount = 0;
+}
+
+void ProcessTimingHistory::addSample(const int64_t durationUs) {
+  if (_samples.empty()) {
+    return;
+  }
+
+  const uint32_t capacity = static_cast<uint32_t>(_samples.size());
+  if (capacity == _samplesCount) {
+    _windowSumUs -= _samples[_nextIdx];
+  } else {
+    ++_samplesCount;
+  }
+
+  _samples[_nextIdx] = durationUs;
+  _windowSumUs += durationUs;
+  _nextIdx = (_nextIdx + 1) % capacity;
+  _lastUs = durationUs;
+  ++_totalSamplesCount;
+}
+
+int64_t ProcessTimingHistory::getAverageUs() const {
+  return (0 == _samplesCount) ? 0 : _windowSumUs / _samplesCount;
+}
+
+int64_t ProcessTimingHistory::getPercentileUs(const uint32_t percentile) const {
+  if (0 == _samplesCount) {
+    return 0;
+  }
+
+  // the window is not in time order, which does not matter for a percentile
+  std::vector<int64_t> sorted(_samples.begin(),
+                              _samples.begin() + _samplesCount);
+  const size_t idx = std::min<size_t>(_samplesCount - 1,
+      (static_cast<size_t>(_samplesCount) * percentile) / 100);
+  std::nth_element(sorted.begin(), sorted.begin() + idx, sorted.end());
+  return sorted[idx];
+}
+
+int64_t ProcessTimingHistory::getMaxUs() const {
+  if (0 == _samplesCount) {
+    return 0;
+  }
+
+  return *std::max_element(_samples.begin(),
+                           _samples.begin() + _samplesCount);
+}
@@ -0,0 +1,101 @@
+// Corresponding header
+#include "manager_utils/managers/helpers/RenderTraceReader.h"
+
+// System headers
+#include <cstring>
+
+// Other libraries headers
+#include "sdl_utils/drawing/DrawParams.h"
+#include "utils/log/Log.h"
+
+// Own components headers
+
+RenderTraceReader::RenderTraceReader() : _file(nullptr) {
+}
+
+RenderTraceReader::~RenderTraceReader() noexcept {
+  close();
+}
+
+ErrorCode RenderTraceReader::open(const char *file) {
+  close();
+
+  _file = fopen(file, "rb");
+  if (nullptr == _file) {
+    LOGERR("Error, could not open render trace file: %s", file);
+    return ErrorCode::FAILURE;
+  }
+
+  char magic[sizeof(RENDER_TRACE_MAGIC)];
+  const bool isHeaderRead =
+      (1 == fread(magic, sizeof(magic), 1, _file)) &&
+      (1 == fread(&_header.version, sizeof(_header.version), 1, _file)) &&
+      (1 == fread(&_header.drawParamsSize, sizeof(_header.drawParamsSize), 1,
+                  _file)) &&
+      (1 == fread(&_header.monitorWidth, sizeof(_header.monitorWidth), 1,
+                  _file)) &&
+      (1 == fread(&_header.monitorHeight, sizeof(_header.monitorHeight), 1,
+                  _file));
+
+  if (!isHeaderRead ||
+      (0 != memcmp(magic, RENDER_TRACE_MAGIC, sizeof(magic)))) {
+    LOGERR("Error, %s is not a render trace file", file);
+    close();
+    return ErrorCode::FAILURE;
+  }
+
+  if (RENDER_TRACE_VERSION != _header.version) {
+    LOGERR("Error, unsupported render trace version: %u. Supported: %u",
+           _header.version, RENDER_TRACE_VERSION);
+    close();
+    return ErrorCode::FAILURE;
+  }
+
+  if (sizeof(DrawParams) != _header.drawParamsSize) {
+    LOGERR("Error, render trace was recorded with sizeof(DrawParams): %u, "
+           "while the current one is: %zu", _header.drawParamsSize,
+           sizeof(DrawParams));
+    close();
+    return ErrorCode::FAILURE;
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+void RenderTraceReader::close() {
+  if (nullptr != _file) {
+    fclose(_file);
+    _file = nullptr;
+  }
+}
+
+bool RenderTraceReader::readNext(RenderTraceRecord &outRecord) {
+  if (nullptr == _file) {
+    return false;
+  }
+
+  uint8_t typeValue = 0;
+  uint8_t cmdValue = 0;
+  uint32_t payloadBytes = 0;
+  if ( (1 != fread(&typeValue, sizeof(typeValue), 1, _file)) ||
+       (1 != fread(&cmdValue, sizeof(cmdValue), 1, _file)) ||
+       (1 != fread(&payloadBytes, sizeof(payloadBytes), 1, _file))) {
+    return false; // end of file
+  }
+
+  if (static_cast<uint8_t>(RenderTraceRecordType::COUNT) <= typeValue) {
+    LOGERR("Error, corrupted render trace record type: %hhu", typeValue);
+    return false;
+  }
+
+  outRecord.type = static_cast<RenderTraceRecordType>(typeValue);
+  outRecord.rendererCmd = static_cast<RendererCmd>(cmdValue);
+  outRecord.payload.resize(payloadBytes);
+  if ( (0 != payloadBytes) &&
+       (1 != fread(outRecord.payload.data(), payloadBytes, 1, _file))) {
+    LOGERR("Error, truncated render trace record");
+    return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,117 @@
+// Corresponding header
+#include "manager_utils/managers/helpers/RenderTraceRecorder.h"
+
+// System headers
+#include <limits>
+
+// Other libraries headers
+#include "sdl_utils/drawing/DrawParams.h"
+#include "utils/log/Log.h"
+
+// Own components headers
+
+namespace {
+constexpr size_t FILE_BUFFER_SIZE = 4 * 1024 * 1024;
+}
+
+RenderTraceRecorder::RenderTraceRecorder()
+    : _file(nullptr), _fileBuffer(nullptr) {
+}
+
+RenderTraceRecorder::~RenderTraceRecorder() noexcept {
+  stop();
+}
+
+ErrorCode RenderTraceRecorder::start(const char *file,
+                                     const int32_t monitorWidth,
+                                     const int32_t monitorHeight) {
+  if (isRecording()) {
+    LOGERR("Error, render trace recording is already started");
+    return ErrorCode::FAILURE;
+  }
+
+  _file = fopen(file, "wb");
+  if (nullptr == _file) {
+    LOGERR("Error, could not open render trace file: %s", file);
+    return ErrorCode::FAILURE;
+  }
+
+  _fileBuffer = new char[FILE_BUFFER_SIZE];
+  setvbuf(_file, _fileBuffer, _IOFBF, FILE_BUFFER_SIZE);
+
+  RenderTraceHeader header;
+  header.version = RENDER_TRACE_VERSION;
+  header.drawParamsSize = sizeof(DrawParams);
+  header.monitorWidth = monitorWidth;
+  header.monitorHeight = monitorHeight;
+
+  fwrite(RENDER_TRACE_MAGIC, sizeof(RENDER_TRACE_MAGIC), 1, _file);
+  fwrite(&header.version, sizeof(header.version), 1, _file);
+  fwrite(&header.drawParamsSize, sizeof(header.drawParamsSize), 1, _file);
+  fwrite(&header.monitorWidth, sizeof(header.monitorWidth), 1, _file);
+  fwrite(&header.monitorHeight, sizeof(header.monitorHeight), 1, _file);
+
+  return ErrorCode::SUCCESS;
+}
+
+void RenderTraceRecorder::stop() {
+  if (nullptr == _file) {
+    return;
+  }
+
+  if (0 != fclose(_file)) {
+    LOGERR("Error, failed to close the render trace file");
+  }
+  _file = nullptr;
+
+  // the buffer must outlive the stream
+  delete[] _fileBuffer;
+  _fileBuffer = nullptr;
+}
+
+void RenderTraceRecorder::recordFrameEnd(const bool overrideRendererLockCheck) {
+  const uint8_t overrideFlag = overrideRendererLockCheck ? 1 : 0;
+  record(RenderTraceRecordType::FRAME_END, &overrideFlag,
+         sizeof(overrideFlag));
+}
+
+void RenderTraceRecorder::recordDrawCmd(const DrawParams &drawParams) {
+  record(RenderTraceRecordType::DRAW_CMD,
+         reinterpret_cast<const uint8_t *>(&drawParams), sizeof(drawParams));
+}
+
+void RenderTraceRecorder::recordOp(const RenderTraceRecordType type,
+                                   const int32_t param) {
+  record(type, reinterpret_cast<const uint8_t *>(&param), sizeof(param));
+}
+
+void RenderTraceRecorder::recordTexture(const RenderTraceRecordType type,
+                                        const RenderTraceTexture &texture) {
+  record(type, reinterpret_cast<const uint8_t *>(&texture), sizeof(texture));
+}
+
+void RenderTraceRecorder::record(const RenderTraceRecordType type,
+                                 const uint8_t *data, const uint64_t bytes,
+                                 const RendererCmd rendererCmd) {
+  if (nullptr == _file) {
+    return;
+  }
+
+  if (std::numeric_limits<uint32_t>::max() < bytes) {
+    LOGERR("Error, render trace record with size: %" PRIu64" is too big. "
+           "Record will be skipped", bytes);
+    return;
+  }
+
+  const uint8_t typeValue = static_cast<uint8_t>(type);
+  const uint8_t cmdValue = static_cast<uint8_t>(rendererCmd);
+  const uint32_t payloadBytes = (nullptr == data) ?
+      0 : static_cast<uint32_t>(bytes);
+
+  fwrite(&typeValue, sizeof(typeValue), 1, _file);
+  fwrite(&cmdValue, sizeof(cmdValue), 1, _file);
+  fwrite(&payloadBytes, sizeof(payloadBytes), 1, _file);
+  if (0 != payloadBytes) {
+    fwrite(data, payloadBytes, 1, _file);
+  }
+}
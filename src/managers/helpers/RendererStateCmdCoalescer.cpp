@@ -0,0 +1,180 @@
+// Corresponding header
+#include "manager_utils/managers/helpers/RendererStateCmdCoalescer.h"
+
+// System headers
+#include <cstring>
+#include <functional>
+
+// Other libraries headers
+#include "utils/data_type/EnumClassUtils.h"
+
+// Own components headers
+
+size_t RendererStateCmdCoalescer::StateKeyHash::operator()(
+    const StateKey &key) const {
+  // containerIds are small sequential numbers (or resource hashes) ->
+  // mixing in the type bits in the upper part is enough
+  const uint64_t typeBits =
+      (static_cast<uint64_t>(getEnumValue(key.widgetType)) << 56) ^
+      (static_cast<uint64_t>(getEnumValue(key.stateType)) << 48);
+  return std::hash<uint64_t>()(key.containerId ^ typeBits);
+}
+
+void RendererStateCmdCoalescer::addBlendModeCmd(const WidgetType widgetType,
+                                                const uint64_t containerId,
+                                                const BlendMode blendMode) {
+  StateKey key;
+  key.containerId = containerId;
+  key.widgetType = widgetType;
+  key.stateType = StateType::BLEND_MODE;
+
+  addCmd(key, static_cast<int32_t>(getEnumValue(blendMode)));
+}
+
+void RendererStateCmdCoalescer::addOpacityCmd(const WidgetType widgetType,
+                                              const uint64_t containerId,
+                                              const int32_t opacity) {
+  StateKey key;
+  key.containerId = containerId;
+  key.widgetType = widgetType;
+  key.stateType = StateType::OPACITY;
+
+  addCmd(key, opacity);
+}
+
+void RendererStateCmdCoalescer::flush(const SubmitCmdCb &submitCb) {
+  if (_pendingCmds.empty()) {
+    return;
+  }
+
+  for (const PendingCmd &cmd : _pendingCmds) {
+    if (cmd.isDiscarded) {
+      continue;
+    }
+
+    auto it = _committedState.find(cmd.key);
+    if ( (_committedState.end() != it) && (it->second == cmd.value)) {
+      // the value was changed back and forth during the frame ->
+      // the renderer already holds it
+      continue;
+    }
+
+    submitCmd(submitCb, cmd);
+    _committedState[cmd.key] = cmd.value;
+    ++_submittedCmdsCount;
+  }
+
+  // clear() keeps the allocated capacity for the next frame
+  _pendingCmds.clear();
+  _pendingIndexes.clear();
+}
+
+void RendererStateCmdCoalescer::onTextureRecreated(const WidgetType widgetType,
+                                                   const uint64_t containerId) {
+  StateKey key;
+  key.containerId = containerId;
+  key.widgetType = widgetType;
+
+  key.stateType = StateType::BLEND_MODE;
+  _committedState.erase(key);
+
+  key.stateType = StateType::OPACITY;
+  _committedState.erase(key);
+}
+
+void RendererStateCmdCoalescer::onTextureDestroyed(const WidgetType widgetType,
+                                                   const uint64_t containerId) {
+  StateKey key;
+  key.containerId = containerId;
+  key.widgetType = widgetType;
+
+  key.stateType = StateType::BLEND_MODE;
+  _committedState.erase(key);
+  removePendingCmd(key);
+
+  key.stateType = StateType::OPACITY;
+  _committedState.erase(key);
+  removePendingCmd(key);
+}
+
+void RendererStateCmdCoalescer::invalidateAll() {
+  _committedState.clear();
+}
+
+void RendererStateCmdCoalescer::resetCounters() {
+  _receivedCmdsCount = 0;
+  _submittedCmdsCount = 0;
+}
+
+void RendererStateCmdCoalescer::addCmd(const StateKey &key,
+                                       const int32_t value) {
+  ++_receivedCmdsCount;
+
+  auto pendingIt = _pendingIndexes.find(key);
+  if (_pendingIndexes.end() != pendingIt) {
+    // last value for the frame wins
+    _pendingCmds[pendingIt->second].value = value;
+    return;
+  }
+
+  auto committedIt = _committedState.find(key);
+  if ( (_committedState.end() != committedIt) &&
+       (committedIt->second == value)) {
+    // no-op for the renderer
+    return;
+  }
+
+  _pendingIndexes.emplace(key, _pendingCmds.size());
+  _pendingCmds.push_back(PendingCmd { key, value });
+}
+
+void RendererStateCmdCoalescer::removePendingCmd(const StateKey &key) {
+  auto it = _pendingIndexes.find(key);
+  if (_pendingIndexes.end() == it) {
+    return;
+  }
+
+  // the remaining indexes stay valid -> no shifting of the vector
+  _pendingCmds[it->second].isDiscarded = true;
+  _pendingIndexes.erase(it);
+}
+
+void RendererStateCmdCoalescer::submitCmd(const SubmitCmdCb &submitCb,
+                                          const PendingCmd &cmd) const {
+  const WidgetType widgetType = cmd.key.widgetType;
+
+  // NOTE: for third parameter either rsrcId(uint64_t) or
+  //      uniqueContainerId(int32_t) so the bigger size is chosen
+  //      for the buffer population
+  uint8_t data[sizeof(widgetType) + sizeof(BlendMode) + sizeof(int32_t) +
+               sizeof(DrawParams::rsrcId)];
+  uint64_t populatedBytes = 0;
+
+  memcpy(data, &widgetType, sizeof(widgetType));
+  populatedBytes += sizeof(widgetType);
+
+  RendererCmd rendererCmd = RendererCmd::CHANGE_TEXTURE_OPACITY;
+  if (StateType::BLEND_MODE == cmd.key.stateType) {
+    rendererCmd = RendererCmd::CHANGE_TEXTURE_BLENDMODE;
+    const BlendMode blendMode = toEnum<BlendMode>(cmd.value);
+    memcpy(data + populatedBytes, &blendMode, sizeof(blendMode));
+    populatedBytes += sizeof(blendMode);
+  } else {
+    memcpy(data + populatedBytes, &cmd.value, sizeof(cmd.value));
+    populatedBytes += sizeof(cmd.value);
+  }
+
+  if (WidgetType::IMAGE == widgetType) {
+    const decltype(DrawParams::rsrcId) rsrcId = cmd.key.containerId;
+    memcpy(data + populatedBytes, &rsrcId, sizeof(rsrcId));
+    populatedBytes += sizeof(rsrcId);
+  } else { // WidgetType::TEXT or WidgetType::SPRITE_BUFFER
+    //textId and and spriteBufferId are the same since they are in a union
+    const auto textId =
+        static_cast<decltype(DrawParams::textId)>(cmd.key.containerId);
+    memcpy(data + populatedBytes, &textId, sizeof(textId));
+    populatedBytes += sizeof(textId);
+  }
+
+  submitCb(rendererCmd, data, populatedBytes);
+}
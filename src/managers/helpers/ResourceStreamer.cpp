@@ -0,0 +1,237 @@
+// Corresponding header
+#include "manager_utils/managers/helpers/ResourceStreamer.h"
+
+// System headers
+#include <algorithm>
+#include <utility>
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+
+namespace {
+// batch IDs, used by the streamer. Kept away from the project batch IDs
+constexpr int32_t STREAMING_BATCH_ID_FIRST = 1 << 30;
+constexpr int32_t STREAMING_BATCH_ID_LAST = STREAMING_BATCH_ID_FIRST + 0xFFFFF;
+}
+
+ResourceStreamer::ResourceStreamer()
+    : _nextTicket(INVALID_STREAM_TICKET + 1),
+      _nextBatchId(STREAMING_BATCH_ID_FIRST), _inFlightCount(0) {
+}
+
+void ResourceStreamer::init(const LoadBatchCb &loadBatchCb,
+                            const UnloadRsrcCb &unloadRsrcCb) {
+  _loadBatchCb = loadBatchCb;
+  _unloadRsrcCb = unloadRsrcCb;
+}
+
+uint64_t ResourceStreamer::submit(const uint64_t rsrcId,
+                                  const int32_t priority,
+                                  const int64_t deadlineMs,
+                                  const uint64_t textureBytes) {
+  Entry entry;
+  entry.rsrcId = rsrcId;
+  entry.textureBytes = textureBytes;
+  entry.priority = priority;
+  entry.hasDeadline = (NO_STREAM_DEADLINE != deadlineMs);
+  if (entry.hasDeadline) {
+    entry.deadline = Clock::now() + std::chrono::milliseconds(deadlineMs);
+  }
+
+  const uint64_t ticket = _nextTicket++;
+  _entries.emplace(ticket, entry);
+  _queued.push_back(ticket);
+
+  return ticket;
+}
+
+uint64_t ResourceStreamer::submitFailed() {
+  Entry entry;
+  entry.state = EntryState::FAILED;
+
+  const uint64_t ticket = _nextTicket++;
+  _entries.emplace(ticket, entry);
+
+  return ticket;
+}
+
+StreamRequestState ResourceStreamer::poll(const uint64_t ticket) {
+  const auto it = _entries.find(ticket);
+  if (_entries.end() == it) {
+    LOGERR("Error, unknown stream ticket: %" PRIu64, ticket);
+    return StreamRequestState::FAILED;
+  }
+
+  switch (it->second.state) {
+  case EntryState::READY:
+    _entries.erase(it);
+    return StreamRequestState::READY;
+
+  case EntryState::FAILED:
+  case EntryState::CANCELLED_IN_FLIGHT:
+    _entries.erase(it);
+    return StreamRequestState::FAILED;
+
+  default:
+    return StreamRequestState::PENDING;
+  }
+}
+
+void ResourceStreamer::cancel(const uint64_t ticket) {
+  const auto it = _entries.find(ticket);
+  if (_entries.end() == it) {
+    return;
+  }
+
+  switch (it->second.state) {
+  case EntryState::QUEUED:
+    _queued.erase(std::find(_queued.begin(), _queued.end(), ticket));
+    _entries.erase(it);
+    break;
+
+  case EntryState::IN_FLIGHT:
+    // the resource is unloaded on batch completion
+    it->second.state = EntryState::CANCELLED_IN_FLIGHT;
+    break;
+
+  case EntryState::READY:
+    _unloadRsrcCb(it->second.rsrcId);
+    _entries.erase(it);
+    break;
+
+  default:
+    _entries.erase(it);
+    break;
+  }
+}
+
+bool ResourceStreamer::isStreamingBatch(const int32_t batchId) {
+  return (STREAMING_BATCH_ID_FIRST <= batchId) &&
+         (STREAMING_BATCH_ID_LAST >= batchId);
+}
+
+void ResourceStreamer::onBatchCompleted(const int32_t batchId) {
+  std::lock_guard<std::mutex> lock(_completedMutex);
+  _completedBatches.push_back(batchId);
+}
+
+void ResourceStreamer::process(const uint64_t uploadBudgetBytes) {
+  applyCompletedBatches();
+
+  if (!_queued.empty()) {
+    dispatchBatch(uploadBudgetBytes);
+  }
+}
+
+void ResourceStreamer::clear() {
+  {
+    std::lock_guard<std::mutex> lock(_completedMutex);
+    _completedBatches.clear();
+  }
+
+  _entries.clear();
+  _queued.clear();
+  _batches.clear();
+  _inFlightCount = 0;
+}
+
+void ResourceStreamer::applyCompletedBatches() {
+  _completedBatchesCopy.clear();
+  {
+    std::lock_guard<std::mutex> lock(_completedMutex);
+    _completedBatchesCopy.swap(_completedBatches);
+  }
+
+  for (const int32_t batchId : _completedBatchesCopy) {
+    const auto batchIt = _batches.find(batchId);
+    if (_batches.end() == batchIt) {
+      LOGERR("Error, received completion for unknown streaming batch: %d",
+             batchId);
+      continue;
+    }
+
+    for (const uint64_t ticket : batchIt->second) {
+      const auto it = _entries.find(ticket);
+      if (_entries.end() == it) {
+        continue;
+      }
+      --_inFlightCount;
+
+      if (EntryState::CANCELLED_IN_FLIGHT == it->second.state) {
+        _unloadRsrcCb(it->second.rsrcId);
+        _entries.erase(it);
+        continue;
+      }
+      it->second.state = EntryState::READY;
+    }
+
+    _batches.erase(batchIt);
+  }
+}
+
+void ResourceStreamer::dispatchBatch(const uint64_t uploadBudgetBytes) {
+  const Clock::time_point now = Clock::now();
+  sortQueued(now);
+
+  _batchRsrcIds.clear();
+  std::vector<uint64_t> batchTickets;
+  uint64_t batchBytes = 0;
+  size_t dispatchedCount = 0;
+  for (const uint64_t ticket : _queued) {
+    Entry &entry = _entries[ticket];
+    const bool isOverdue = entry.hasDeadline && (now >= entry.deadline);
+    const bool fitsBudget =
+        batchTickets.empty() ||
+        (uploadBudgetBytes >= batchBytes + entry.textureBytes);
+    if (!isOverdue && !fitsBudget) {
+      // the queue is sorted -> the rest will not be overdue either
+      break;
+    }
+
+    batchBytes += entry.textureBytes;
+    entry.state = EntryState::IN_FLIGHT;
+    _batchRsrcIds.push_back(entry.rsrcId);
+    batchTickets.push_back(ticket);
+    ++dispatchedCount;
+  }
+  _queued.erase(_queued.begin(), _queued.begin() + dispatchedCount);
+
+  const int32_t batchId = _nextBatchId;
+  _nextBatchId = (STREAMING_BATCH_ID_LAST == _nextBatchId) ?
+      STREAMING_BATCH_ID_FIRST : (_nextBatchId + 1);
+
+  _inFlightCount += static_cast<uint32_t>(batchTickets.size());
+  _batches[batchId] = std::move(batchTickets);
+  _loadBatchCb(_batchRsrcIds, batchId);
+}
+
+void ResourceStreamer::sortQueued(const Clock::time_point now) {
+  std::stable_sort(_queued.begin(), _queued.end(),
+      [this, now](const uint64_t lhsTicket, const uint64_t rhsTicket) {
+        const Entry &lhs = _entries[lhsTicket];
+        const Entry &rhs = _entries[rhsTicket];
+
+        const bool isLhsOverdue = lhs.hasDeadline && (now >= lhs.deadline);
+        const bool isRhsOverdue = rhs.hasDeadline && (now >= rhs.deadline);
+        if (isLhsOverdue != isRhsOverdue) {
+          return isLhsOverdue;
+        }
+
+        if (lhs.priority != rhs.priority) {
+          return lhs.priority > rhs.priority;
+        }
+
+        if (lhs.hasDeadline != rhs.hasDeadline) {
+          return lhs.hasDeadline;
+        }
+
+        if (lhs.hasDeadline && (lhs.deadline != rhs.deadline)) {
+          return lhs.deadline < rhs.deadline;
+        }
+
+        // tickets are monotonic -> submission order
+        return lhsTicket < rhsTicket;
+      });
+}
@@ -0,0 +1,93 @@
+// Corresponding header
+#include "manager_utils/managers/helpers/SoundTriggerLimiter.h"
+
+// System headers
+
+// Other libraries headers
+
+// Own components headers
+
+void SoundTriggerLimiter::setLimits(const uint64_t rsrcId,
+                                    const SoundPlaybackLimits &limits) {
+  ChunkTriggerData &data = _chunks[rsrcId];
+  data.limits = limits;
+  data.hasCustomLimits = true;
+}
+
+void SoundTriggerLimiter::resetLimits(const uint64_t rsrcId) {
+  const auto it = _chunks.find(rsrcId);
+  if (_chunks.end() != it) {
+    it->second.limits = SoundPlaybackLimits();
+    it->second.hasCustomLimits = false;
+  }
+}
+
+SoundTriggerDecision SoundTriggerLimiter::onPlayRequested(
+    const uint64_t rsrcId, const int32_t activeInstancesCount,
+    const int64_t nowMs) {
+  const auto it = _chunks.find(rsrcId);
+  const SoundPlaybackLimits &limits =
+      ( (_chunks.end() != it) && it->second.hasCustomLimits) ?
+          it->second.limits : _defaultLimits;
+
+  // no limits -> no need to track the chunk at all
+  if ( (0 >= limits.minRetriggerIntervalMs) && (0 >= limits.maxInstances)) {
+    ++_totalStats.startedPlaysCount;
+    if (_chunks.end() != it) {
+      ++it->second.stats.startedPlaysCount;
+    }
+    return SoundTriggerDecision::PLAY;
+  }
+
+  ChunkTriggerData &data = (_chunks.end() != it) ? it->second : _chunks[rsrcId];
+
+  // merging requires a voice to merge into
+  if ( (0 < activeInstancesCount) && (0 < limits.minRetriggerIntervalMs) &&
+       (NO_PLAY_STARTED != data.lastStartMs) &&
+       (nowMs - data.lastStartMs < limits.minRetriggerIntervalMs)) {
+    ++data.stats.mergedPlaysCount;
+    ++_totalStats.mergedPlaysCount;
+    return SoundTriggerDecision::MERGE;
+  }
+
+  if ( (0 < limits.maxInstances) &&
+       (limits.maxInstances <= activeInstancesCount)) {
+    ++data.stats.droppedPlaysCount;
+    ++_totalStats.droppedPlaysCount;
+    return SoundTriggerDecision::DROP;
+  }
+
+  data.prevStartMs = data.lastStartMs;
+  data.lastStartMs = nowMs;
+  ++data.stats.startedPlaysCount;
+  ++_totalStats.startedPlaysCount;
+  return SoundTriggerDecision::PLAY;
+}
+
+void SoundTriggerLimiter::onPlayFailed(const uint64_t rsrcId) {
+  if (0 < _totalStats.startedPlaysCount) {
+    --_totalStats.startedPlaysCount;
+  }
+
+  const auto it = _chunks.find(rsrcId);
+  if (_chunks.end() == it) {
+    return;
+  }
+
+  ChunkTriggerData &data = it->second;
+  data.lastStartMs = data.prevStartMs;
+  data.prevStartMs = NO_PLAY_STARTED;
+  if (0 < data.stats.startedPlaysCount) {
+    --data.stats.startedPlaysCount;
+  }
+}
+
+SoundTriggerStats SoundTriggerLimiter::getStats(const uint64_t rsrcId) const {
+  const auto it = _chunks.find(rsrcId);
+  return (_chunks.end() == it) ? SoundTriggerStats() : it->second.stats;
+}
+
+void SoundTriggerLimiter::clear() {
+  _chunks.clear();
+  _totalStats = SoundTriggerStats();
+}
@@ -0,0 +1,106 @@
+// Corresponding header
+#include "manager_utils/managers/helpers/StartupProfiler.h"
+
+// System headers
+#include <cinttypes>
+#include <algorithm>
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "manager_utils/trace/Tracer.h"
+
+StartupProfiler *gStartupProfiler = nullptr;
+
+StartupProfiler::StartupProfiler()
+    : _topSlowestAssetsCount(0), _isActive(false) {
+}
+
+void StartupProfiler::start(const uint32_t topSlowestAssetsCount) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  _assets.clear();
+  _topSlowestAssetsCount = topSlowestAssetsCount;
+  _startTime = Clock::now();
+  _stopTime = _startTime;
+  _isActive = true;
+}
+
+void StartupProfiler::stop() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (_isActive) {
+    _stopTime = Clock::now();
+    _isActive = false;
+  }
+}
+
+void StartupProfiler::recordAssetLoad(const char *category,
+                                      const uint64_t assetId,
+                                      const Clock::time_point startTime,
+                                      const Clock::time_point endTime) {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (!_isActive) {
+    return;
+  }
+
+  AssetRecord record;
+  record.category = category;
+  record.assetId = assetId;
+  record.startUs = toUs(startTime);
+  record.durationUs = toUs(endTime) - record.startUs;
+  _assets.push_back(record);
+}
+
+void StartupProfiler::logSummary() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  const Clock::time_point endTime = _isActive ? Clock::now() : _stopTime;
+
+  int64_t totalAssetsUs = 0;
+  for (const AssetRecord &asset : _assets) {
+    totalAssetsUs += asset.durationUs;
+  }
+  LOG("Startup took [%" PRId64" ms]. %zu assets loaded for [%" PRId64
+      " ms]", toUs(endTime) / 1000, _assets.size(), totalAssetsUs / 1000);
+
+  sortAssetsBySlowest();
+  const size_t reportedCount =
+      std::min(_assets.size(), static_cast<size_t>(_topSlowestAssetsCount));
+  for (size_t i = 0; i < reportedCount; ++i) {
+    LOG("  slowest #%zu: %s %" PRIu64" [%" PRId64" us]", i + 1,
+        _assets[i].category, _assets[i].assetId, _assets[i].durationUs);
+  }
+}
+
+int64_t StartupProfiler::toUs(const Clock::time_point timePoint) const {
+  return std::chrono::duration_cast<std::chrono::microseconds>(
+      timePoint - _startTime).count();
+}
+
+void StartupProfiler::sortAssetsBySlowest() {
+  std::stable_sort(_assets.begin(), _assets.end(),
+      [](const AssetRecord &lhs, const AssetRecord &rhs) {
+        return lhs.durationUs > rhs.durationUs;
+      });
+}
+
+StartupAssetScope::StartupAssetScope(const char *category,
+                                     const uint64_t assetId)
+    : _category(category), _assetId(assetId),
+      _traceStartNs(Tracer::isEnabled() ? Tracer::now() : -1),
+      _isRecording( (nullptr != gStartupProfiler) &&
+                    gStartupProfiler->isActive()) {
+  if (_isRecording) {
+    _startTime = StartupProfiler::Clock::now();
+  }
+}
+
+StartupAssetScope::~StartupAssetScope() noexcept {
+  if (0 <= _traceStartNs) {
+    Tracer::record(_category, _traceStartNs, Tracer::now(), _assetId);
+  }
+
+  if (_isRecording && (nullptr != gStartupProfiler)) {
+    gStartupProfiler->recordAssetLoad(_category, _assetId, _startTime,
+                                      StartupProfiler::Clock::now());
+  }
+}
@@ -0,0 +1,213 @@
+// Corresponding header
+#include "manager_utils/managers/helpers/TextTextureCache.h"
+
+// System headers
+#include <cstring>
+
+// Other libraries headers
+
+// Own components headers
+#include "manager_utils/drawing/TextContent.h"
+
+namespace {
+constexpr uint32_t DEFAULT_MAX_RETAINED_TEXTS = 16;
+
+// RGBA32 texture
+constexpr uint64_t TEXT_BYTES_PER_PIXEL = 4;
+
+uint64_t hashContent(const char *text) {
+  size_t length = 0;
+  return TextContent::computeHash(text, length);
+}
+}
+
+size_t TextTextureCache::KeyHash::operator()(const Key &key) const {
+  uint64_t hash = key.contentHash;
+  hash ^= key.fontId + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+
+  const uint8_t *colorBytes = reinterpret_cast<const uint8_t *>(&key.color);
+  for (size_t i = 0; i < sizeof(key.color); ++i) {
+    hash ^= colorBytes[i] + 0x9e3779b97f4a7c15ULL + (hash << 6) + (hash >> 2);
+  }
+
+  return static_cast<size_t>(hash);
+}
+
+TextTextureCache::TextTextureCache()
+    : _maxRetainedTexts(DEFAULT_MAX_RETAINED_TEXTS), _hits(0), _misses(0),
+      _bytesSaved(0) {
+}
+
+bool TextTextureCache::acquire(const uint64_t fontId, const char *text,
+                               const Color &color, CachedTextData &outData) {
+  const auto keyIt = _keyToTextId.find(makeKey(fontId, text, color));
+  if (_keyToTextId.end() == keyIt) {
+    ++_misses;
+    return false;
+  }
+
+  Entry &entry = _entries[keyIt->second];
+  if (0 != strcmp(entry.content.c_str(), text)) {
+    // hash collision
+    ++_misses;
+    return false;
+  }
+
+  if (0 == entry.refCount) {
+    // reused a retained text -> no new sharer
+    _retainedTextIds.erase(entry.retainedIt);
+  } else {
+    _bytesSaved += getTextureBytes(entry.data);
+  }
+  ++entry.refCount;
+
+  ++_hits;
+
+  outData = entry.data;
+  return true;
+}
+
+void TextTextureCache::insert(const uint64_t fontId, const char *text,
+                              const Color &color,
+                              const CachedTextData &data) {
+  const Key key = makeKey(fontId, text, color);
+  if (!_keyToTextId.emplace(key, data.textId).second) {
+    // hash collision with a different content -> keep the text private
+    return;
+  }
+
+  Entry &entry = _entries[data.textId];
+  entry.key = key;
+  entry.content = text;
+  entry.data = data;
+  entry.refCount = 1;
+}
+
+void TextTextureCache::release(const int32_t textId,
+                               std::vector<int32_t> &outUnloadTextIds) {
+  const auto entryIt = _entries.find(textId);
+  if (_entries.end() == entryIt) {
+    // private text
+    outUnloadTextIds.push_back(textId);
+    return;
+  }
+
+  Entry &entry = entryIt->second;
+  --entry.refCount;
+  if (0 != entry.refCount) {
+    // one sharer less
+    _bytesSaved -= getTextureBytes(entry.data);
+    return;
+  }
+
+  entry.retainedIt =
+      _retainedTextIds.insert(_retainedTextIds.end(), textId);
+  evictRetained(_maxRetainedTexts, outUnloadTextIds);
+}
+
+bool TextTextureCache::detach(const int32_t textId) {
+  const auto entryIt = _entries.find(textId);
+  if (_entries.end() == entryIt) {
+    // already private
+    return false;
+  }
+
+  Entry &entry = entryIt->second;
+  if (1 < entry.refCount) {
+    --entry.refCount;
+    _bytesSaved -= getTextureBytes(entry.data);
+    return true;
+  }
+
+  removeEntry(textId);
+  return false;
+}
+
+void TextTextureCache::reattach(const int32_t textId) {
+  const auto entryIt = _entries.find(textId);
+  if (_entries.end() == entryIt) {
+    // the text was not shared
+    return;
+  }
+
+  // ::detach() released a reference of a shared text -> it is still
+  // referenced (not retained)
+  Entry &entry = entryIt->second;
+  ++entry.refCount;
+  _bytesSaved += getTextureBytes(entry.data);
+}
+
+bool TextTextureCache::getTextSource(const int32_t textId,
+                                     uint64_t &outFontId,
+                                     std::string &outContent,
+                                     Color &outColor) const {
+  const auto entryIt = _entries.find(textId);
+  if (_entries.end() == entryIt) {
+    return false;
+  }
+
+  outFontId = entryIt->second.key.fontId;
+  outContent = entryIt->second.content;
+  outColor = entryIt->second.key.color;
+  return true;
+}
+
+void TextTextureCache::clear(std::vector<int32_t> &outUnloadTextIds) {
+  evictRetained(0, outUnloadTextIds);
+
+  _keyToTextId.clear();
+  _entries.clear();
+  _bytesSaved = 0;
+}
+
+void TextTextureCache::setMaxRetainedTexts(const uint32_t maxRetainedTexts) {
+  _maxRetainedTexts = maxRetainedTexts;
+}
+
+TextCacheStats TextTextureCache::getStats() const {
+  TextCacheStats stats;
+  stats.hits = _hits;
+  stats.misses = _misses;
+  stats.bytesSaved = _bytesSaved;
+  stats.cachedTextsCount = static_cast<uint32_t>(_entries.size());
+  stats.retainedTextsCount = static_cast<uint32_t>(_retainedTextIds.size());
+
+  return stats;
+}
+
+TextTextureCache::Key TextTextureCache::makeKey(const uint64_t fontId,
+                                                const char *text,
+                                                const Color &color) {
+  Key key;
+  key.fontId = fontId;
+  key.contentHash = hashContent(text);
+  key.color = color;
+
+  return key;
+}
+
+void TextTextureCache::evictRetained(const uint32_t maxRetained,
+                                     std::vector<int32_t> &outUnloadTextIds) {
+  while (maxRetained < _retainedTextIds.size()) {
+    const int32_t textId = _retainedTextIds.front();
+    _retainedTextIds.pop_front();
+
+    removeEntry(textId);
+    outUnloadTextIds.push_back(textId);
+  }
+}
+
+void TextTextureCache::removeEntry(const int32_t textId) {
+  const auto entryIt = _entries.find(textId);
+  if (_entries.end() == entryIt) {
+    return;
+  }
+
+  _keyToTextId.erase(entryIt->second.key);
+  _entries.erase(entryIt);
+}
+
+uint64_t TextTextureCache::getTextureBytes(const CachedTextData &data) {
+  return static_cast<uint64_t>(data.width) *
+         static_cast<uint64_t>(data.height) * TEXT_BYTES_PER_PIXEL;
+}
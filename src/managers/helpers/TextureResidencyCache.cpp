@@ -0,0 +1,155 @@
+// Corresponding header
+#include "manager_utils/managers/helpers/TextureResidencyCache.h"
+
+// System headers
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+
+namespace {
+constexpr uint64_t DEFAULT_VRAM_BUDGET_BYTES = 128 * 1024 * 1024;
+}
+
+TextureResidencyCache::TextureResidencyCache()
+    : _vramBudgetBytes(DEFAULT_VRAM_BUDGET_BYTES), _residentBytes(0),
+      _retainedBytes(0), _totalRefCount(0), _referencedCount(0), _hits(0),
+      _misses(0), _evictions(0) {
+}
+
+bool TextureResidencyCache::acquire(const uint64_t rsrcId) {
+  const auto it = _entries.find(rsrcId);
+  if (_entries.end() == it) {
+    ++_misses;
+    return false;
+  }
+
+  Entry &entry = it->second;
+  if (0 == entry.refCount) {
+    // revive a retained texture. Only this is a residency hit - further
+    // references to an already referenced texture are not counted
+    _lru.erase(entry.lruIt);
+    _retainedBytes -= entry.textureBytes;
+    ++_referencedCount;
+    ++_hits;
+  }
+  ++entry.refCount;
+  ++_totalRefCount;
+
+  return true;
+}
+
+void TextureResidencyCache::insert(const uint64_t rsrcId,
+                                   const uint64_t textureBytes,
+                                   const bool isLoading) {
+  Entry entry;
+  entry.textureBytes = textureBytes;
+  entry.refCount = 1;
+  entry.isLoading = isLoading;
+  if (!_entries.emplace(rsrcId, entry).second) {
+    LOGERR("Error, on-demand texture for rsrcId: %" PRIu64" is already "
+           "tracked", rsrcId);
+    return;
+  }
+
+  _residentBytes += textureBytes;
+  ++_totalRefCount;
+  ++_referencedCount;
+}
+
+void TextureResidencyCache::onLoaded(const uint64_t rsrcId) {
+  const auto it = _entries.find(rsrcId);
+  if (_entries.end() != it) {
+    it->second.isLoading = false;
+  }
+}
+
+bool TextureResidencyCache::isLoading(const uint64_t rsrcId) const {
+  const auto it = _entries.find(rsrcId);
+  return (_entries.end() != it) && it->second.isLoading;
+}
+
+bool TextureResidencyCache::release(const uint64_t rsrcId) {
+  const auto it = _entries.find(rsrcId);
+  if ( (_entries.end() == it) || (0 == it->second.refCount)) {
+    LOGERR("Error, releasing not referenced on-demand texture for rsrcId: %"
+           PRIu64, rsrcId);
+    return true;
+  }
+
+  Entry &entry = it->second;
+  --entry.refCount;
+  --_totalRefCount;
+  if (0 == entry.refCount) {
+    --_referencedCount;
+    _lru.push_front(rsrcId);
+    entry.lruIt = _lru.begin();
+    _retainedBytes += entry.textureBytes;
+  }
+
+  return false;
+}
+
+void TextureResidencyCache::collectEvictions(
+    std::vector<uint64_t> &outRsrcIds) {
+  // start from the least recently used
+  auto lruIt = _lru.end();
+  while ( (_vramBudgetBytes < _residentBytes) && (_lru.begin() != lruIt)) {
+    --lruIt;
+    const uint64_t rsrcId = *lruIt;
+    const auto it = _entries.find(rsrcId);
+    if (it->second.isLoading) {
+      // unloading it would race with the upload. Evicted once loaded
+      continue;
+    }
+
+    _residentBytes -= it->second.textureBytes;
+    _retainedBytes -= it->second.textureBytes;
+    _entries.erase(it);
+    lruIt = _lru.erase(lruIt);
+
+    outRsrcIds.push_back(rsrcId);
+    ++_evictions;
+  }
+}
+
+void TextureResidencyCache::clear(std::vector<uint64_t> &outRsrcIds) {
+  outRsrcIds.insert(outRsrcIds.end(), _lru.begin(), _lru.end());
+
+  _entries.clear();
+  _lru.clear();
+  _residentBytes = 0;
+  _retainedBytes = 0;
+  _totalRefCount = 0;
+  _referencedCount = 0;
+}
+
+uint32_t TextureResidencyCache::getRefCount(const uint64_t rsrcId) const {
+  const auto it = _entries.find(rsrcId);
+  return (_entries.end() == it) ? 0 : it->second.refCount;
+}
+
+void TextureResidencyCache::collectRefCounts(
+    std::vector<std::pair<uint64_t, uint32_t>> &outRefCounts) const {
+  for (const auto &[rsrcId, entry] : _entries) {
+    if (0 != entry.refCount) {
+      outRefCounts.emplace_back(rsrcId, entry.refCount);
+    }
+  }
+}
+
+TextureResidencyStats TextureResidencyCache::getStats() const {
+  TextureResidencyStats stats;
+  stats.hits = _hits;
+  stats.misses = _misses;
+  stats.evictions = _evictions;
+  stats.residentBytes = _residentBytes;
+  stats.retainedBytes = _retainedBytes;
+  stats.vramBudgetBytes = _vramBudgetBytes;
+  stats.retainedTexturesCount = static_cast<uint32_t>(_lru.size());
+  stats.referencedTexturesCount = _referencedCount;
+  stats.totalRefCount = _totalRefCount;
+
+  return stats;
+}
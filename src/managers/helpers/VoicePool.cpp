@@ -0,0 +1,163 @@
+// Corresponding header
+#include "manager_utils/managers/helpers/VoicePool.h"
+
+// System headers
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+
+VoicePool::VoicePool() : _reservedVoicesCount(0) {
+}
+
+ErrorCode VoicePool::init(const int32_t voicesCount,
+                          const int32_t reservedVoicesCount) {
+  if ( (0 > reservedVoicesCount) || (voicesCount <= reservedVoicesCount)) {
+    LOGERR("Error, invalid voicesCount: %d for reservedVoicesCount: %d",
+           voicesCount, reservedVoicesCount);
+    return ErrorCode::FAILURE;
+  }
+
+  deinit();
+  _voices.resize(voicesCount);
+  _reservedVoicesCount = reservedVoicesCount;
+  _rsrcVoices.reserve(voicesCount);
+  for (int32_t i = reservedVoicesCount; i < voicesCount; ++i) {
+    pushBack(_freeList, i);
+  }
+  _stats.voicesCount = voicesCount - reservedVoicesCount;
+
+  return ErrorCode::SUCCESS;
+}
+
+void VoicePool::deinit() {
+  _voices.clear();
+  _freeList = VoiceList();
+  for (VoiceList &list : _busyLists) {
+    list = VoiceList();
+  }
+  _rsrcVoices.clear();
+  _reservedVoicesCount = 0;
+  _stats = VoicePoolStats();
+}
+
+int32_t VoicePool::allocate(const uint64_t rsrcId,
+                            const SoundPriority priority) {
+  const int32_t voice = _freeList.head;
+  if (INVALID_VOICE == voice) {
+    return INVALID_VOICE;
+  }
+  unlink(_freeList, voice);
+
+  Voice &data = _voices[voice];
+  data.rsrcId = rsrcId;
+  data.priority = priority;
+  data.isBusy = true;
+  pushBack(_busyLists[static_cast<int32_t>(priority)], voice);
+
+  // the new voice becomes the head of its rsrcId chain
+  data.prevSameRsrc = INVALID_VOICE;
+  data.nextSameRsrc = INVALID_VOICE;
+  RsrcVoices &rsrcVoices = _rsrcVoices[rsrcId];
+  if (INVALID_VOICE != rsrcVoices.head) {
+    data.nextSameRsrc = rsrcVoices.head;
+    _voices[rsrcVoices.head].prevSameRsrc = voice;
+  }
+  rsrcVoices.head = voice;
+  ++rsrcVoices.instancesCount;
+
+  ++_stats.busyVoicesCount;
+  return voice;
+}
+
+int32_t VoicePool::findStealCandidate(const SoundPriority priority) const {
+  const int32_t maxPriority = static_cast<int32_t>(priority);
+  for (int32_t i = 0; i <= maxPriority; ++i) {
+    if (INVALID_VOICE != _busyLists[i].head) {
+      return _busyLists[i].head;
+    }
+  }
+
+  return INVALID_VOICE;
+}
+
+void VoicePool::release(const int32_t voice) {
+  if (!isBusy(voice)) {
+    return;
+  }
+
+  Voice &data = _voices[voice];
+  unlink(_busyLists[static_cast<int32_t>(data.priority)], voice);
+
+  if (INVALID_VOICE != data.nextSameRsrc) {
+    _voices[data.nextSameRsrc].prevSameRsrc = data.prevSameRsrc;
+  }
+  if (INVALID_VOICE != data.prevSameRsrc) {
+    _voices[data.prevSameRsrc].nextSameRsrc = data.nextSameRsrc;
+  }
+
+  const auto it = _rsrcVoices.find(data.rsrcId);
+  if (0 == --it->second.instancesCount) {
+    _rsrcVoices.erase(it);
+  } else if (voice == it->second.head) {
+    it->second.head = data.nextSameRsrc;
+  }
+
+  data = Voice();
+  pushBack(_freeList, voice);
+  --_stats.busyVoicesCount;
+}
+
+bool VoicePool::isBusy(const int32_t voice) const {
+  return (_reservedVoicesCount <= voice) &&
+         (static_cast<int32_t>(_voices.size()) > voice) &&
+         _voices[voice].isBusy;
+}
+
+uint64_t VoicePool::getRsrcId(const int32_t voice) const {
+  return isBusy(voice) ? _voices[voice].rsrcId : 0;
+}
+
+int32_t VoicePool::findVoice(const uint64_t rsrcId) const {
+  const auto it = _rsrcVoices.find(rsrcId);
+  return (_rsrcVoices.end() == it) ? INVALID_VOICE : it->second.head;
+}
+
+int32_t VoicePool::getInstancesCount(const uint64_t rsrcId) const {
+  const auto it = _rsrcVoices.find(rsrcId);
+  return (_rsrcVoices.end() == it) ? 0 : it->second.instancesCount;
+}
+
+int32_t VoicePool::getNextSameRsrcVoice(const int32_t voice) const {
+  return isBusy(voice) ? _voices[voice].nextSameRsrc : INVALID_VOICE;
+}
+
+void VoicePool::pushBack(VoiceList &list, const int32_t voice) {
+  Voice &data = _voices[voice];
+  data.prev = list.tail;
+  data.next = INVALID_VOICE;
+  if (INVALID_VOICE == list.tail) {
+    list.head = voice;
+  } else {
+    _voices[list.tail].next = voice;
+  }
+  list.tail = voice;
+}
+
+void VoicePool::unlink(VoiceList &list, const int32_t voice) {
+  Voice &data = _voices[voice];
+  if (INVALID_VOICE == data.prev) {
+    list.head = data.next;
+  } else {
+    _voices[data.prev].next = data.next;
+  }
+
+  if (INVALID_VOICE == data.next) {
+    list.tail = data.prev;
+  } else {
+    _voices[data.next].prev = data.prev;
+  }
+  data.prev = INVALID_VOICE;
+  data.next = INVALID_VOICE;
+}
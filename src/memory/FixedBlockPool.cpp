@@ -0,0 +1,110 @@
+// Corresponding header
+#include "manager_utils/memory/FixedBlockPool.h"
+
+// System headers
+#include <new>
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+
+namespace {
+constexpr size_t BLOCK_ALIGNMENT = alignof(std::max_align_t);
+
+constexpr size_t alignBlockSize(const size_t blockSize) {
+  return ((blockSize + BLOCK_ALIGNMENT - 1) / BLOCK_ALIGNMENT) *
+         BLOCK_ALIGNMENT;
+}
+}
+
+FixedBlockPool::FixedBlockPool(const size_t blockSize,
+                               const size_t blocksPerChunk)
+    : _freeList(nullptr), _blockSize(alignBlockSize(blockSize)),
+      _blocksPerChunk(blocksPerChunk), _allocationsCount(0),
+      _liveBlocksCount(0), _peakLiveBlocksCount(0) {
+}
+
+FixedBlockPool::~FixedBlockPool() noexcept {
+  if (0 != _liveBlocksCount) {
+    LOGERR("Warning, FixedBlockPool with blockSize: %zu destroyed while "
+           "having %" PRIu64" live blocks", _blockSize, _liveBlocksCount);
+  }
+
+  for (uint8_t *chunk : _chunks) {
+    ::operator delete[](chunk, std::align_val_t(BLOCK_ALIGNMENT));
+  }
+  _chunks.clear();
+  _freeList = nullptr;
+}
+
+void *FixedBlockPool::allocate() {
+  std::lock_guard<std::mutex> lock(_mutex);
+  if ( (nullptr == _freeList) && !reserveChunk()) {
+    return nullptr;
+  }
+
+  FreeBlock *block = _freeList;
+  _freeList = block->next;
+
+  ++_allocationsCount;
+  ++_liveBlocksCount;
+  if (_liveBlocksCount > _peakLiveBlocksCount) {
+    _peakLiveBlocksCount = _liveBlocksCount;
+  }
+
+  return block;
+}
+
+void FixedBlockPool::deallocate(void *block) {
+  if (nullptr == block) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(_mutex);
+  FreeBlock *freeBlock = static_cast<FreeBlock *>(block);
+  freeBlock->next = _freeList;
+  _freeList = freeBlock;
+  --_liveBlocksCount;
+}
+
+uint64_t FixedBlockPool::getAllocationsCount() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _allocationsCount;
+}
+
+uint64_t FixedBlockPool::getLiveBlocksCount() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _liveBlocksCount;
+}
+
+uint64_t FixedBlockPool::getPeakLiveBlocksCount() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _peakLiveBlocksCount;
+}
+
+uint64_t FixedBlockPool::getReservedBytes() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _chunks.size() * _blocksPerChunk * _blockSize;
+}
+
+bool FixedBlockPool::reserveChunk() {
+  uint8_t *chunk = static_cast<uint8_t *>(::operator new[](
+      _blocksPerChunk * _blockSize, std::align_val_t(BLOCK_ALIGNMENT),
+      std::nothrow));
+  if (nullptr == chunk) {
+    LOGERR("Error, bad alloc for FixedBlockPool chunk with blockSize: %zu",
+           _blockSize);
+    return false;
+  }
+  _chunks.push_back(chunk);
+
+  // thread the new blocks in the free list
+  for (size_t i = 0; i < _blocksPerChunk; ++i) {
+    FreeBlock *block = reinterpret_cast<FreeBlock *>(chunk + (i * _blockSize));
+    block->next = _freeList;
+    _freeList = block;
+  }
+
+  return true;
+}
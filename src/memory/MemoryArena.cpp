@@ -0,0 +1,120 @@
+// Corresponding header
+#include "manager_utils/memory/MemoryArena.h"
+
+// System headers
+#include <cassert>
+#include <new>
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+
+namespace {
+constexpr size_t ARENA_ALIGNMENT = alignof(std::max_align_t);
+
+constexpr size_t alignArenaSize(const size_t bytes) {
+  return ((bytes + ARENA_ALIGNMENT - 1) / ARENA_ALIGNMENT) * ARENA_ALIGNMENT;
+}
+}
+
+MemoryArena::MemoryArena(const size_t chunkSize)
+    : _currChunkIdx(0), _currChunkOffset(0),
+      _chunkSize(alignArenaSize(chunkSize)), _allocationsCount(0),
+      _liveAllocationsCount(0), _usedBytes(0), _reservedBytes(0) {
+}
+
+MemoryArena::~MemoryArena() noexcept {
+  /** The headers of the live allocations point to this arena.
+   *  Their memory is left reserved (leaked), so the live objects are not
+   *  placed in freed memory. Destroying them afterwards is still a bug.
+   * */
+  if (0 != _liveAllocationsCount) {
+    LOGERR("Error, MemoryArena destroyed while having %" PRIu64" live "
+           "allocations. Leaking %" PRIu64" reserved bytes. Destroy the "
+           "objects allocated from the arena first",
+           _liveAllocationsCount.load(), _reservedBytes);
+    assert(0 == _liveAllocationsCount && "MemoryArena has live allocations");
+    return;
+  }
+
+  freeChunks();
+}
+
+void *MemoryArena::allocate(const size_t bytes) {
+  const size_t alignedBytes = alignArenaSize(bytes);
+
+  // advance through the already reserved chunks (they are reused after
+  // ::reset()) before reserving a new one
+  while ( (_currChunkIdx < _chunks.size()) &&
+          (_currChunkOffset + alignedBytes > _chunks[_currChunkIdx].size)) {
+    ++_currChunkIdx;
+    _currChunkOffset = 0;
+  }
+
+  if ( (_currChunkIdx == _chunks.size()) && !reserveChunk(alignedBytes)) {
+    return nullptr;
+  }
+
+  void *memory = _chunks[_currChunkIdx].memory + _currChunkOffset;
+  _currChunkOffset += alignedBytes;
+
+  ++_allocationsCount;
+  ++_liveAllocationsCount;
+  _usedBytes += alignedBytes;
+
+  return memory;
+}
+
+ErrorCode MemoryArena::reset() {
+  if (0 != _liveAllocationsCount) {
+    LOGERR("Error, MemoryArena could not be reset while having %" PRIu64" "
+           "live allocations. Destroy the objects allocated from the arena "
+           "first", _liveAllocationsCount.load());
+    return ErrorCode::FAILURE;
+  }
+
+  _currChunkIdx = 0;
+  _currChunkOffset = 0;
+  _usedBytes = 0;
+
+  return ErrorCode::SUCCESS;
+}
+
+ErrorCode MemoryArena::release() {
+  if (ErrorCode::SUCCESS != reset()) {
+    LOGERR("Error, reset() failed");
+    return ErrorCode::FAILURE;
+  }
+
+  freeChunks();
+  return ErrorCode::SUCCESS;
+}
+
+bool MemoryArena::reserveChunk(const size_t minBytes) {
+  Chunk chunk;
+  chunk.size = (minBytes > _chunkSize) ? minBytes : _chunkSize;
+  chunk.memory = static_cast<uint8_t *>(::operator new[](chunk.size,
+      std::align_val_t(ARENA_ALIGNMENT), std::nothrow));
+  if (nullptr == chunk.memory) {
+    LOGERR("Error, bad alloc for MemoryArena chunk with size: %zu",
+           chunk.size);
+    return false;
+  }
+
+  _chunks.push_back(chunk);
+  _reservedBytes += chunk.size;
+
+  return true;
+}
+
+void MemoryArena::freeChunks() {
+  for (Chunk &chunk : _chunks) {
+    ::operator delete[](chunk.memory, std::align_val_t(ARENA_ALIGNMENT));
+  }
+
+  _chunks.clear();
+  _currChunkIdx = 0;
+  _currChunkOffset = 0;
+  _reservedBytes = 0;
+}
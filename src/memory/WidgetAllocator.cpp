@@ -0,0 +1,171 @@
+// Corresponding header
+#include "manager_utils/memory/WidgetAllocator.h"
+
+// System headers
+#include <array>
+#include <atomic>
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "manager_utils/memory/FixedBlockPool.h"
+#include "manager_utils/memory/MemoryArena.h"
+
+namespace {
+enum class AllocationOrigin : uint8_t {
+  POOL,
+  ARENA,
+  HEAP
+};
+
+struct alignas(std::max_align_t) AllocationHeader {
+  void *owner = nullptr;
+  uint32_t capacity = 0;
+  AllocationOrigin origin = AllocationOrigin::HEAP;
+};
+
+constexpr size_t HEADER_SIZE = sizeof(AllocationHeader);
+constexpr size_t BLOCKS_PER_CHUNK = 64;
+
+// total block sizes (the header included)
+constexpr std::array<size_t, 5> POOL_BLOCK_SIZES { 64, 128, 256, 512, 1024 };
+
+struct WidgetPools {
+  WidgetPools()
+      : pools { { { POOL_BLOCK_SIZES[0], BLOCKS_PER_CHUNK },
+                  { POOL_BLOCK_SIZES[1], BLOCKS_PER_CHUNK },
+                  { POOL_BLOCK_SIZES[2], BLOCKS_PER_CHUNK },
+                  { POOL_BLOCK_SIZES[3], BLOCKS_PER_CHUNK },
+                  { POOL_BLOCK_SIZES[4], BLOCKS_PER_CHUNK } } } {
+  }
+
+  std::array<FixedBlockPool, POOL_BLOCK_SIZES.size()> pools;
+
+  std::atomic<uint64_t> arenaAllocations { 0 };
+  std::atomic<uint64_t> heapAllocations { 0 };
+  std::atomic<uint64_t> deallocations { 0 };
+};
+
+/** Widgets with static storage duration could be destroyed after any
+ *  static pool -> the pools are intentionally never destroyed.
+ * */
+WidgetPools &getPools() {
+  static WidgetPools *pools = new WidgetPools;
+  return *pools;
+}
+
+thread_local MemoryArena *gActiveArena = nullptr;
+
+AllocationHeader *getHeader(const void *memory) {
+  return reinterpret_cast<AllocationHeader *>(
+      const_cast<uint8_t *>(static_cast<const uint8_t *>(memory)) -
+      HEADER_SIZE);
+}
+
+void *finalizeAllocation(void *block, void *owner, const size_t blockSize,
+                         const AllocationOrigin origin) {
+  AllocationHeader *header = new (block) AllocationHeader;
+  header->owner = owner;
+  header->capacity = static_cast<uint32_t>(blockSize - HEADER_SIZE);
+  header->origin = origin;
+
+  return static_cast<uint8_t *>(block) + HEADER_SIZE;
+}
+}
+
+void *WidgetAllocator::allocate(const size_t bytes) {
+  const size_t totalBytes = bytes + HEADER_SIZE;
+  WidgetPools &widgetPools = getPools();
+
+  if (nullptr != gActiveArena) {
+    void *block = gActiveArena->allocate(totalBytes);
+    if (nullptr == block) {
+      return nullptr;
+    }
+    ++widgetPools.arenaAllocations;
+    return finalizeAllocation(block, gActiveArena, totalBytes,
+        AllocationOrigin::ARENA);
+  }
+
+  for (FixedBlockPool &pool : widgetPools.pools) {
+    if (totalBytes <= pool.getBlockSize()) {
+      void *block = pool.allocate();
+      if (nullptr == block) {
+        return nullptr;
+      }
+      return finalizeAllocation(block, &pool, pool.getBlockSize(),
+          AllocationOrigin::POOL);
+    }
+  }
+
+  void *block = ::operator new(totalBytes, std::nothrow);
+  if (nullptr == block) {
+    LOGERR("Error, bad alloc for %zu bytes", bytes);
+    return nullptr;
+  }
+  ++widgetPools.heapAllocations;
+  return finalizeAllocation(block, nullptr, totalBytes,
+      AllocationOrigin::HEAP);
+}
+
+void WidgetAllocator::deallocate(void *memory) {
+  if (nullptr == memory) {
+    return;
+  }
+
+  AllocationHeader *header = getHeader(memory);
+  ++getPools().deallocations;
+
+  switch (header->origin) {
+  case AllocationOrigin::POOL:
+    static_cast<FixedBlockPool *>(header->owner)->deallocate(header);
+    break;
+
+  case AllocationOrigin::ARENA:
+    // the memory is reclaimed in bulk on MemoryArena::reset()
+    static_cast<MemoryArena *>(header->owner)->onDeallocate();
+    break;
+
+  case AllocationOrigin::HEAP:
+    ::operator delete(header);
+    break;
+
+  default:
+    LOGERR("Error, received corrupted allocation header");
+    break;
+  }
+}
+
+size_t WidgetAllocator::getUsableSize(const void *memory) {
+  if (nullptr == memory) {
+    return 0;
+  }
+
+  return getHeader(memory)->capacity;
+}
+
+MemoryArena *WidgetAllocator::setActiveArena(MemoryArena *arena) {
+  MemoryArena *prevArena = gActiveArena;
+  gActiveArena = arena;
+  return prevArena;
+}
+
+WidgetAllocatorStats WidgetAllocator::getStats() {
+  const WidgetPools &widgetPools = getPools();
+
+  WidgetAllocatorStats stats;
+  for (const FixedBlockPool &pool : widgetPools.pools) {
+    stats.poolAllocations += pool.getAllocationsCount();
+    stats.poolReservedBytes += pool.getReservedBytes();
+  }
+  stats.arenaAllocations = widgetPools.arenaAllocations;
+  stats.heapAllocations = widgetPools.heapAllocations;
+  stats.deallocations = widgetPools.deallocations;
+
+  const uint64_t totalAllocations = stats.poolAllocations +
+      stats.arenaAllocations + stats.heapAllocations;
+  stats.liveAllocations = totalAllocations - stats.deallocations;
+
+  return stats;
+}
@@ -10,13 +10,19 @@
 // Own components headers
 #include "manager_utils/managers/SoundMgr.h"
 
-Sound::Sound(Sound&& movedOther) : SoundWidget(std::move(movedOther)) {}
+Sound::Sound(Sound&& movedOther)
+    : SoundWidget(std::move(movedOther)), _priority(movedOther._priority) {
+  movedOther._priority = SoundPriority::NORMAL;
+}
 
 Sound& Sound::operator=(Sound&& movedOther) {
   // check for self-assignment
   if (this != &movedOther) {
     // implicitly invoke SoundWidget move assignment operator
     SoundWidget::operator=(std::move(movedOther));
+
+    _priority = movedOther._priority;
+    movedOther._priority = SoundPriority::NORMAL;
   }
 
   return *this;
@@ -63,7 +69,7 @@ void Sound::setVolume(const SoundLevel soundLevel) {
 }
 
 void Sound::play(const int32_t loops) {
-  gSoundMgr->playChunk(_rsrcId, loops, _endCb);
+  gSoundMgr->playChunk(_rsrcId, loops, _endCb, _priority);
 }
 
 void Sound::playWithPanning(const int32_t loops, const int32_t leftVolume,
@@ -89,7 +95,7 @@ void Sound::playWithPanning(const int32_t loops, const int32_t leftVolume,
 
   gSoundMgr->playChunkWithPanning(
       _rsrcId, loops, static_cast<uint8_t>(leftVolume),
-      static_cast<uint8_t>(rightVolume), _endCb);
+      static_cast<uint8_t>(rightVolume), _endCb, _priority);
 }
 
 void Sound::stop() { gSoundMgr->stopChunk(_rsrcId); }
@@ -0,0 +1,326 @@
+// Corresponding header
+#include "manager_utils/trace/Tracer.h"
+
+// System headers
+#include <cinttypes>
+#include <cstdio>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+// Other libraries headers
+#include "utils/log/Log.h"
+
+// Own components headers
+
+std::atomic<bool> Tracer::_isEnabled { false };
+
+namespace {
+struct TraceEvent {
+  const char *name;
+  int64_t startNs;
+  int64_t durationNs;
+  uint64_t id;
+  bool hasId;
+};
+
+// single producer (the owning thread), single consumer (the flush)
+class TraceRing {
+public:
+  explicit TraceRing(const uint32_t capacity)
+      : _events(capacity), _mask(capacity - 1), _threadName(nullptr),
+        _tid(0), _isOwned(false), _head(0), _tail(0), _droppedCount(0) {
+  }
+
+  void push(const TraceEvent &event) {
+    const uint64_t head = _head.load(std::memory_order_relaxed);
+    const uint64_t tail = _tail.load(std::memory_order_acquire);
+    if (_events.size() <= head - tail) {
+      _droppedCount.fetch_add(1, std::memory_order_relaxed);
+      return;
+    }
+
+    _events[head & _mask] = event;
+    _head.store(head + 1, std::memory_order_release);
+  }
+
+  template <typename Func>
+  void drain(const Func &func) {
+    const uint64_t tail = _tail.load(std::memory_order_relaxed);
+    const uint64_t head = _head.load(std::memory_order_acquire);
+    for (uint64_t i = tail; i < head; ++i) {
+      func(_events[i & _mask]);
+    }
+    _tail.store(head, std::memory_order_release);
+  }
+
+  bool isEmpty() const {
+    return _head.load(std::memory_order_acquire) ==
+           _tail.load(std::memory_order_acquire);
+  }
+
+  // the members below are guarded by the TraceRegistry mutex
+  void acquire(const uint64_t tid, const char *threadName) {
+    _tid = tid;
+    _isOwned = true;
+    setThreadName(threadName);
+  }
+
+  void release() {
+    _isOwned = false;
+  }
+
+  bool isOwned() const {
+    return _isOwned;
+  }
+
+  uint64_t getTid() const {
+    return _tid;
+  }
+
+  uint32_t getCapacity() const {
+    return static_cast<uint32_t>(_events.size());
+  }
+
+  void setThreadName(const char *name) {
+    _threadName.store(name, std::memory_order_relaxed);
+  }
+
+  const char *getThreadName() const {
+    return _threadName.load(std::memory_order_relaxed);
+  }
+
+  uint64_t getDroppedCount() const {
+    return _droppedCount.load(std::memory_order_relaxed);
+  }
+
+private:
+  std::vector<TraceEvent> _events;
+  const uint64_t _mask;
+  std::atomic<const char *> _threadName;
+
+  // unique per owning thread, so a recycled ring is not attributed
+  // to its previous thread in the trace
+  uint64_t _tid;
+  bool _isOwned;
+
+  // written by the producer
+  alignas(64) std::atomic<uint64_t> _head;
+
+  // written by the consumer
+  alignas(64) std::atomic<uint64_t> _tail;
+
+  std::atomic<uint64_t> _droppedCount;
+};
+
+struct TraceRegistry {
+  std::mutex mutex;
+
+  // rings of exited threads are kept until they are drained and are
+  // then reused by new threads
+  std::vector<std::unique_ptr<TraceRing>> rings;
+  uint32_t ringCapacity = 64 * 1024;
+  uint64_t nextTid = 1;
+  const std::chrono::steady_clock::time_point epoch =
+      std::chrono::steady_clock::now();
+};
+
+TraceRegistry &getRegistry() {
+  // intentionally leaked, so threads that outlive static destruction
+  // could still record safely
+  static TraceRegistry *registry = new TraceRegistry;
+  return *registry;
+}
+
+thread_local TraceRing *tlsRing = nullptr;
+
+// set once the thread releases its ring on exit
+thread_local bool tlsIsRingReleased = false;
+
+// kept aside until the thread records its first event, so naming a thread
+// does not allocate a ring while tracing is disabled
+thread_local const char *tlsThreadName = nullptr;
+
+// hands the ring of an exiting thread back to the registry
+struct ThreadRingOwner {
+  ~ThreadRingOwner() noexcept {
+    if (nullptr == ring) {
+      return;
+    }
+
+    TraceRegistry &registry = getRegistry();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    ring->release();
+    tlsRing = nullptr;
+    tlsIsRingReleased = true;
+  }
+
+  TraceRing *ring = nullptr;
+};
+
+thread_local ThreadRingOwner tlsRingOwner;
+
+TraceRing *acquireThreadRing() {
+  if (nullptr != tlsRing) {
+    return tlsRing;
+  }
+
+  if (tlsIsRingReleased) {
+    // the thread is exiting
+    return nullptr;
+  }
+
+  TraceRegistry &registry = getRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  TraceRing *ring = nullptr;
+  for (const auto &freeRing : registry.rings) {
+    if (!freeRing->isOwned() && freeRing->isEmpty() &&
+        (registry.ringCapacity == freeRing->getCapacity())) {
+      ring = freeRing.get();
+      break;
+    }
+  }
+
+  if (nullptr == ring) {
+    registry.rings.push_back(
+        std::make_unique<TraceRing>(registry.ringCapacity));
+    ring = registry.rings.back().get();
+  }
+
+  ring->acquire(registry.nextTid, tlsThreadName);
+  ++registry.nextTid;
+
+  // the owner releases the ring on thread exit
+  tlsRingOwner.ring = ring;
+  tlsRing = ring;
+
+  return tlsRing;
+}
+
+uint32_t roundUpToPowerOf2(const uint32_t value) {
+  uint32_t result = 1;
+  while (result < value) {
+    result <<= 1;
+  }
+  return result;
+}
+}
+
+void Tracer::enable(const uint32_t eventsPerThread) {
+  TraceRegistry &registry = getRegistry();
+  {
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    registry.ringCapacity = roundUpToPowerOf2(eventsPerThread);
+  }
+
+  _isEnabled.store(true, std::memory_order_relaxed);
+}
+
+void Tracer::disable() {
+  _isEnabled.store(false, std::memory_order_relaxed);
+}
+
+void Tracer::setThreadName(const char *name) {
+  tlsThreadName = name;
+  if (nullptr != tlsRing) {
+    tlsRing->setThreadName(name);
+  }
+}
+
+void Tracer::record(const char *name, const int64_t startNs,
+                    const int64_t endNs) {
+  TraceEvent event;
+  event.name = name;
+  event.startNs = startNs;
+  event.durationNs = endNs - startNs;
+  event.id = 0;
+  event.hasId = false;
+
+  TraceRing *ring = acquireThreadRing();
+  if (nullptr != ring) {
+    ring->push(event);
+  }
+}
+
+void Tracer::record(const char *name, const int64_t startNs,
+                    const int64_t endNs, const uint64_t id) {
+  TraceEvent event;
+  event.name = name;
+  event.startNs = startNs;
+  event.durationNs = endNs - startNs;
+  event.id = id;
+  event.hasId = true;
+
+  TraceRing *ring = acquireThreadRing();
+  if (nullptr != ring) {
+    ring->push(event);
+  }
+}
+
+int64_t Tracer::now() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - getRegistry().epoch).count();
+}
+
+ErrorCode Tracer::flushChromeTrace(const char *file) {
+  FILE *output = fopen(file, "a");
+  if (nullptr == output) {
+    LOGERR("Error, could not open trace file: %s", file);
+    return ErrorCode::FAILURE;
+  }
+
+  // JSON Array Format - the closing bracket is optional, so every flush
+  // appends its events after the previously flushed ones
+  fseek(output, 0, SEEK_END);
+  if (0 == ftell(output)) {
+    fprintf(output, "[\n");
+  }
+
+  TraceRegistry &registry = getRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+  for (const auto &ringPtr : registry.rings) {
+    TraceRing &ring = *ringPtr;
+    if (ring.isEmpty()) {
+      continue;
+    }
+
+    const uint64_t tid = ring.getTid();
+    const char *threadName = ring.getThreadName();
+    if (nullptr != threadName) {
+      fprintf(output, "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,"
+              "\"tid\":%" PRIu64",\"args\":{\"name\":\"%s\"}},\n",
+              tid, threadName);
+    }
+
+    ring.drain([output, tid](const TraceEvent &event) {
+      fprintf(output, "{\"name\":\"%s\",\"ph\":\"X\",\"ts\":%.3f,"
+              "\"dur\":%.3f,\"pid\":1,\"tid\":%" PRIu64,
+              event.name, static_cast<double>(event.startNs) / 1000.0,
+              static_cast<double>(event.durationNs) / 1000.0, tid);
+      if (event.hasId) {
+        fprintf(output, ",\"args\":{\"id\":%" PRIu64"}", event.id);
+      }
+      fprintf(output, "},\n");
+    });
+  }
+
+  const bool isWriteFailed = (0 != ferror(output));
+  if ( (0 != fclose(output)) || isWriteFailed) {
+    LOGERR("Error, failed to write trace file: %s", file);
+    return ErrorCode::FAILURE;
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+uint64_t Tracer::getDroppedEventsCount() {
+  TraceRegistry &registry = getRegistry();
+  std::lock_guard<std::mutex> lock(registry.mutex);
+
+  uint64_t droppedCount = 0;
+  for (const auto &ring : registry.rings) {
+    droppedCount += ring->getDroppedCount();
+  }
+  return droppedCount;
+}
@@ -0,0 +1,485 @@
+/*
+ * render_trace_replay
+ *
+ *  Brief: Replays a render trace, recorded with
+ *         DrawMgr::startTraceRecording(), and reports per frame timing.
+ *
+ *  Usage: render_trace_replay <trace_file> [--headless] [--repeat N]
+ *                                          [--per-frame]
+ *
+ *         --headless  - use SDL's offscreen video driver and the software
+ *                       renderer (no display or GPU required)
+ *         --repeat N  - replay the trace N times (default 1)
+ *         --per-frame - print the time of every frame
+ *
+ *  NOTE: the trace holds only the command stream. Textures that were
+ *        loaded by the recording application are not available. Every
+ *        texture is substituted with a placeholder Fbo of the recorded
+ *        size (the size from the TEXTURE_CREATED record, or the drawn
+ *        frame size for textures created before the recording started),
+ *        so the measured numbers cover the renderer command processing
+ *        and the draw call submission for the captured workload.
+ */
+
+// System headers
+#include <cstdint>
+#include <cinttypes>
+#include <cstdio>
+#include <cstring>
+#include <chrono>
+#include <cstdlib>
+#include <algorithm>
+#include <map>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// Other libraries headers
+#include <SDL.h>
+#include "sdl_utils/drawing/DrawParams.h"
+#include "utils/ErrorCode.h"
+#include "utils/log/Log.h"
+
+// Own components headers
+#include "manager_utils/managers/config/ManagerHandlerConfig.h"
+#include "manager_utils/managers/helpers/RenderTraceReader.h"
+#include "manager_utils/managers/ManagerHandler.h"
+#include "manager_utils/managers/DrawMgr.h"
+#include "manager_utils/managers/RsrcMgr.h"
+
+namespace {
+struct ReplayOptions {
+  const char *traceFile = nullptr;
+  int32_t repeatCount = 1;
+  bool isHeadless = false;
+  bool printPerFrame = false;
+};
+
+ErrorCode parseArgs(const int argc, char **argv, ReplayOptions &outOptions) {
+  for (int i = 1; i < argc; ++i) {
+    if (0 == strcmp(argv[i], "--headless")) {
+      outOptions.isHeadless = true;
+    } else if (0 == strcmp(argv[i], "--per-frame")) {
+      outOptions.printPerFrame = true;
+    } else if ( (0 == strcmp(argv[i], "--repeat")) && (i + 1 < argc)) {
+      outOptions.repeatCount = atoi(argv[++i]);
+    } else if (nullptr == outOptions.traceFile) {
+      outOptions.traceFile = argv[i];
+    } else {
+      LOGERR("Error, unknown argument: %s", argv[i]);
+      return ErrorCode::FAILURE;
+    }
+  }
+
+  if ( (nullptr == outOptions.traceFile) || (0 >= outOptions.repeatCount)) {
+    LOGERR("Usage: %s <trace_file> [--headless] [--repeat N] [--per-frame]",
+           argv[0]);
+    return ErrorCode::FAILURE;
+  }
+
+  return ErrorCode::SUCCESS;
+}
+
+/* The textures of the recording application do not exist in the replay
+ * process -> every recorded texture id is substituted with a placeholder
+ * Fbo of the recorded size.
+ * IMAGE and TEXT placeholders are only read from, so they are shared
+ * between all textures of the same size. SPRITE_BUFFER placeholders are
+ * render targets and are created per recorded Fbo.
+ * */
+class PlaceholderTextures {
+public:
+  void onTextureCreated(const RenderTraceTexture &texture) {
+    const uint64_t key = makeKey(texture.widgetType, texture.containerId);
+    if (WidgetType::SPRITE_BUFFER == texture.widgetType) {
+      destroyTargetPlaceholder(key);
+      _placeholderIds[key] = createTargetPlaceholder(texture.width,
+                                                     texture.height);
+      return;
+    }
+
+    _placeholderIds[key] = acquireSourcePlaceholder(texture.width,
+                                                    texture.height);
+  }
+
+  void onTextureDestroyed(const RenderTraceTexture &texture) {
+    const uint64_t key = makeKey(texture.widgetType, texture.containerId);
+    if (WidgetType::SPRITE_BUFFER == texture.widgetType) {
+      destroyTargetPlaceholder(key);
+    }
+    _placeholderIds.erase(key);
+  }
+
+  void remapDrawParams(DrawParams &drawParams) {
+    const uint64_t containerId = (WidgetType::IMAGE == drawParams.widgetType) ?
+        drawParams.rsrcId : static_cast<uint64_t>(drawParams.textId);
+    const uint64_t key = makeKey(drawParams.widgetType, containerId);
+
+    auto it = _placeholderIds.find(key);
+    if (_placeholderIds.end() == it) {
+      // created before the recording was started -> use the drawn size
+      const int32_t placeholderId =
+          (WidgetType::SPRITE_BUFFER == drawParams.widgetType) ?
+              createTargetPlaceholder(drawParams.frameRect.w,
+                                      drawParams.frameRect.h) :
+              acquireSourcePlaceholder(drawParams.frameRect.w,
+                                       drawParams.frameRect.h);
+      it = _placeholderIds.emplace(key, placeholderId).first;
+    }
+
+    if (WidgetType::SPRITE_BUFFER != drawParams.widgetType) {
+      // sprite sheet frames are drawn from the start of the placeholder
+      drawParams.frameRect.x = 0;
+      drawParams.frameRect.y = 0;
+    }
+    drawParams.widgetType = WidgetType::SPRITE_BUFFER;
+    drawParams.spriteBufferId = it->second;
+  }
+
+  /** @return bool - false if the command targets an unknown texture
+   *                 and should be skipped
+   * */
+  bool remapRendererCmd(const RendererCmd rendererCmd,
+                        std::vector<uint8_t> &payload) {
+    switch (rendererCmd) {
+    case RendererCmd::CHANGE_TEXTURE_BLENDMODE:
+      return remapTextureStateCmd(sizeof(BlendMode), payload);
+
+    case RendererCmd::CHANGE_TEXTURE_OPACITY:
+      return remapTextureStateCmd(sizeof(int32_t), payload);
+
+    case RendererCmd::CHANGE_RENDERER_TARGET: {
+      int32_t fboId = 0;
+      if (sizeof(fboId) > payload.size()) {
+        return false;
+      }
+      memcpy(&fboId, payload.data(), sizeof(fboId));
+
+      const auto it = _placeholderIds.find(makeKey(
+          WidgetType::SPRITE_BUFFER, static_cast<uint64_t>(fboId)));
+      if (_placeholderIds.end() == it) {
+        return false;
+      }
+      memcpy(payload.data(), &it->second, sizeof(it->second));
+      return true;
+    }
+
+    case RendererCmd::UPDATE_RENDERER_TARGET: {
+      DrawParams drawParams;
+      const size_t count = payload.size() / sizeof(DrawParams);
+      for (size_t i = 0; i < count; ++i) {
+        uint8_t *data = payload.data() + (i * sizeof(DrawParams));
+        memcpy(&drawParams, data, sizeof(drawParams));
+        remapDrawParams(drawParams);
+        memcpy(data, &drawParams, sizeof(drawParams));
+      }
+      return true;
+    }
+
+    default:
+      return true;
+    }
+  }
+
+  void destroyAll() {
+    for (const auto &pair : _targetPlaceholders) {
+      gRsrcMgr->destroyFbo(pair.second);
+    }
+    for (const auto &pair : _sourcePlaceholders) {
+      gRsrcMgr->destroyFbo(pair.second);
+    }
+    _targetPlaceholders.clear();
+    _sourcePlaceholders.clear();
+    _placeholderIds.clear();
+  }
+
+private:
+  static uint64_t makeKey(const WidgetType widgetType,
+                          const uint64_t containerId) {
+    return (static_cast<uint64_t>(widgetType) << 56) ^ containerId;
+  }
+
+  static int32_t createFbo(const int32_t width, const int32_t height) {
+    int32_t fboId = 0;
+    gRsrcMgr->createFbo(std::max(1, width), std::max(1, height), fboId);
+    return fboId;
+  }
+
+  int32_t acquireSourcePlaceholder(const int32_t width,
+                                   const int32_t height) {
+    const auto size = std::make_pair(width, height);
+    auto it = _sourcePlaceholders.find(size);
+    if (_sourcePlaceholders.end() == it) {
+      it = _sourcePlaceholders.emplace(size, createFbo(width, height)).first;
+    }
+    return it->second;
+  }
+
+  int32_t createTargetPlaceholder(const int32_t width,
+                                  const int32_t height) {
+    const int32_t fboId = createFbo(width, height);
+    _targetPlaceholders[fboId] = fboId;
+    return fboId;
+  }
+
+  void destroyTargetPlaceholder(const uint64_t key) {
+    const auto it = _placeholderIds.find(key);
+    if (_placeholderIds.end() == it) {
+      return;
+    }
+    gRsrcMgr->destroyFbo(it->second);
+    _targetPlaceholders.erase(it->second);
+  }
+
+  /* payload layout:
+   * [WidgetType][value][rsrcId(uint64_t) for IMAGE, int32_t id otherwise]
+   * */
+  bool remapTextureStateCmd(const size_t valueBytes,
+                            std::vector<uint8_t> &payload) {
+    WidgetType widgetType = WidgetType::IMAGE;
+    if (sizeof(widgetType) > payload.size()) {
+      return false;
+    }
+    memcpy(&widgetType, payload.data(), sizeof(widgetType));
+
+    const size_t idOffset = sizeof(widgetType) + valueBytes;
+    uint64_t containerId = 0;
+    if (WidgetType::IMAGE == widgetType) {
+      if (idOffset + sizeof(uint64_t) > payload.size()) {
+        return false;
+      }
+      memcpy(&containerId, payload.data() + idOffset, sizeof(uint64_t));
+    } else {
+      int32_t id = 0;
+      if (idOffset + sizeof(id) > payload.size()) {
+        return false;
+      }
+      memcpy(&id, payload.data() + idOffset, sizeof(id));
+      containerId = static_cast<uint64_t>(id);
+    }
+
+    const auto it = _placeholderIds.find(makeKey(widgetType, containerId));
+    if (_placeholderIds.end() == it) {
+      return false;
+    }
+
+    const WidgetType placeholderType = WidgetType::SPRITE_BUFFER;
+    memcpy(payload.data(), &placeholderType, sizeof(placeholderType));
+    payload.resize(idOffset + sizeof(it->second));
+    memcpy(payload.data() + idOffset, &it->second, sizeof(it->second));
+    return true;
+  }
+
+  // makeKey(widgetType, recorded id) -> placeholder Fbo id
+  std::unordered_map<uint64_t, int32_t> _placeholderIds;
+
+  // (width, height) -> shared IMAGE/TEXT placeholder Fbo id
+  std::map<std::pair<int32_t, int32_t>, int32_t> _sourcePlaceholders;
+
+  // SPRITE_BUFFER placeholder Fbo ids
+  std::map<int32_t, int32_t> _targetPlaceholders;
+};
+
+void replayRecord(RenderTraceRecord &record,
+                  PlaceholderTextures &placeholders) {
+  const uint8_t *data = record.payload.empty() ?
+      nullptr : record.payload.data();
+  int32_t param = 0;
+  RenderTraceTexture texture;
+
+  switch (record.type) {
+  case RenderTraceRecordType::FRAME_BEGIN:
+    gDrawMgr->clearScreen();
+    break;
+
+  case RenderTraceRecordType::FRAME_END:
+    gDrawMgr->finishFrame( (nullptr != data) && (0 != data[0]));
+    break;
+
+  case RenderTraceRecordType::DRAW_CMD: {
+    DrawParams drawParams;
+    memcpy(&drawParams, data, sizeof(drawParams));
+    placeholders.remapDrawParams(drawParams);
+    gDrawMgr->addDrawCmd(drawParams);
+    break;
+  }
+
+  case RenderTraceRecordType::RENDERER_CMD:
+    if (placeholders.remapRendererCmd(record.rendererCmd, record.payload)) {
+      gDrawMgr->addRendererCmd(record.rendererCmd,
+          record.payload.empty() ? nullptr : record.payload.data(),
+          record.payload.size());
+    }
+    break;
+
+  case RenderTraceRecordType::RENDERER_DATA:
+    gDrawMgr->addRendererData(data, record.payload.size());
+    break;
+
+  case RenderTraceRecordType::LOCK_RENDERER:
+    gDrawMgr->lockRenderer();
+    break;
+
+  case RenderTraceRecordType::UNLOCK_RENDERER:
+    gDrawMgr->unlockRenderer();
+    break;
+
+  case RenderTraceRecordType::MOVE_GLOBAL_X:
+    memcpy(&param, data, sizeof(param));
+    gDrawMgr->moveGlobalX(param);
+    break;
+
+  case RenderTraceRecordType::MOVE_GLOBAL_Y:
+    memcpy(&param, data, sizeof(param));
+    gDrawMgr->moveGlobalY(param);
+    break;
+
+  case RenderTraceRecordType::RESET_GLOBAL_MOVEMENT:
+    gDrawMgr->resetAbsoluteGlobalMovement();
+    break;
+
+  case RenderTraceRecordType::TEXTURE_CREATED:
+    memcpy(&texture, data, sizeof(texture));
+    placeholders.onTextureCreated(texture);
+    break;
+
+  case RenderTraceRecordType::TEXTURE_DESTROYED:
+    memcpy(&texture, data, sizeof(texture));
+    placeholders.onTextureDestroyed(texture);
+    break;
+
+  default:
+    LOGERR("Error, received unsupported record type: %hhu",
+           static_cast<uint8_t>(record.type));
+    break;
+  }
+}
+
+ErrorCode replayTrace(const ReplayOptions &options,
+                      std::vector<int64_t> &outFrameTimesUs) {
+  using Clock = std::chrono::steady_clock;
+
+  RenderTraceReader reader;
+  RenderTraceRecord record;
+  PlaceholderTextures placeholders;
+  for (int32_t i = 0; i < options.repeatCount; ++i) {
+    if (ErrorCode::SUCCESS != reader.open(options.traceFile)) {
+      LOGERR("Error, reader.open() failed");
+      placeholders.destroyAll();
+      return ErrorCode::FAILURE;
+    }
+
+    Clock::time_point frameStartTime = Clock::now();
+    while (reader.readNext(record)) {
+      if (RenderTraceRecordType::FRAME_BEGIN == record.type) {
+        frameStartTime = Clock::now();
+      }
+
+      replayRecord(record, placeholders);
+
+      if (RenderTraceRecordType::FRAME_END == record.type) {
+        outFrameTimesUs.push_back(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                Clock::now() - frameStartTime).count());
+      }
+    }
+  }
+  placeholders.destroyAll();
+
+  return ErrorCode::SUCCESS;
+}
+
+void printReport(const ReplayOptions &options,
+                 std::vector<int64_t> &frameTimesUs) {
+  if (frameTimesUs.empty()) {
+    printf("No frames were replayed\n");
+    return;
+  }
+
+  if (options.printPerFrame) {
+    for (size_t i = 0; i < frameTimesUs.size(); ++i) {
+      printf("frame %zu: %" PRId64 " us\n", i, frameTimesUs[i]);
+    }
+  }
+
+  int64_t totalUs = 0;
+  for (const int64_t frameTimeUs : frameTimesUs) {
+    totalUs += frameTimeUs;
+  }
+
+  std::sort(frameTimesUs.begin(), frameTimesUs.end());
+  const size_t count = frameTimesUs.size();
+  auto percentile = [&frameTimesUs, count](const size_t pct) {
+    return frameTimesUs[std::min(count - 1, (count * pct) / 100)];
+  };
+
+  printf("frames: %zu, total: %" PRId64 " us\n", count, totalUs);
+  printf("frame time [us] - min: %" PRId64 ", avg: %" PRId64 ", p50: %"
+         PRId64 ", p99: %" PRId64 ", max: %" PRId64 "\n",
+         frameTimesUs.front(), totalUs / static_cast<int64_t>(count),
+         percentile(50), percentile(99), frameTimesUs.back());
+}
+} //end anonymous namespace
+
+int main(int argc, char **argv) {
+  ReplayOptions options;
+  if (ErrorCode::SUCCESS != parseArgs(argc, argv, options)) {
+    return EXIT_FAILURE;
+  }
+
+  RenderTraceHeader header;
+  {
+    RenderTraceReader reader;
+    if (ErrorCode::SUCCESS != reader.open(options.traceFile)) {
+      return EXIT_FAILURE;
+    }
+    header = reader.getHeader();
+  }
+
+  if (options.isHeadless) {
+    SDL_setenv("SDL_VIDEODRIVER", "offscreen", 1);
+    SDL_SetHint(SDL_HINT_RENDER_DRIVER, "software");
+  }
+
+  if (0 != SDL_Init(SDL_INIT_VIDEO)) {
+    LOGERR("Error, SDL_Init() failed: %s", SDL_GetError());
+    return EXIT_FAILURE;
+  }
+
+  ManagerHandlerConfig cfg;
+  cfg.drawMgrCfg.monitorWindowConfig.width = header.monitorWidth;
+  cfg.drawMgrCfg.monitorWindowConfig.height = header.monitorHeight;
+
+  ManagerHandler managerHandler;
+  if (ErrorCode::SUCCESS != managerHandler.init(cfg)) {
+    LOGERR("Error, managerHandler.init() failed");
+    managerHandler.deinit();
+    SDL_Quit();
+    return EXIT_FAILURE;
+  }
+  gDrawMgr->setSDLContainers(gRsrcMgr);
+
+  std::vector<int64_t> frameTimesUs;
+  ErrorCode replayErrCode = ErrorCode::SUCCESS;
+  if (RendererPolicy::MULTI_THREADED == gDrawMgr->getRendererPolicy()) {
+    // the render loop must be executed on the main thread
+    std::thread replayThread([&]() {
+      replayErrCode = replayTrace(options, frameTimesUs);
+      gDrawMgr->shutdownRenderer();
+    });
+    gDrawMgr->startRenderingLoop();
+    replayThread.join();
+  } else {
+    replayErrCode = replayTrace(options, frameTimesUs);
+  }
+
+  if (ErrorCode::SUCCESS == replayErrCode) {
+    printReport(options, frameTimesUs);
+  }
+
+  managerHandler.deinit();
+  SDL_Quit();
+
+  return (ErrorCode::SUCCESS == replayErrCode) ? EXIT_SUCCESS : EXIT_FAILURE;
+}